@@ -64,6 +64,17 @@ namespace IceInternal
             // else we ignore this call.
         }
 
+        // The response must refer to the Current object returned by current().
+        void sendResponse(Ice::OutgoingResponse response) noexcept
+        {
+            assert(&response.current() == &_current);
+            if (!_responseSent.test_and_set())
+            {
+                _sendResponse(std::move(response));
+            }
+            // else we ignore this call.
+        }
+
         void sendException(std::exception_ptr ex) noexcept
         {
             if (!_responseSent.test_and_set())
@@ -7,6 +7,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -61,6 +62,10 @@ namespace IceInternal
             Container(const std::vector<value_type>&) noexcept;
             Container(Container&, bool) noexcept;
 
+            // Refers to memory shared with other containers and kept alive by owner, see share(). The container can
+            // write to this memory, so the other containers and owners must no longer read the range [beg, end).
+            Container(std::shared_ptr<const std::byte> owner, iterator beg, iterator end) noexcept;
+
             Container(Container&&) noexcept;
             Container& operator=(Container&&) noexcept;
 
@@ -83,17 +88,24 @@ namespace IceInternal
 
             [[nodiscard]] bool ownsMemory() const noexcept { return _owned; }
 
+            [[nodiscard]] bool sharesMemory() const noexcept { return _shared != nullptr; }
+
             void swap(Container&) noexcept;
 
             void clear();
 
+            // Shares the ownership of the memory of this container. The container no longer owns the memory: it's
+            // released when the container and all the returned owners are destroyed, and the next resize allocates
+            // new memory. Returns nullptr if the memory isn't owned by this container and can't be shared.
+            std::shared_ptr<const std::byte> share();
+
             void resize(size_type n) // Inlined for performance reasons.
             {
                 if (n == 0)
                 {
                     clear();
                 }
-                else if (n > _capacity)
+                else if (n > _capacity || _shared)
                 {
                     reserve(n);
                 }
@@ -149,6 +161,7 @@ namespace IceInternal
             size_type _capacity;
             int _shrinkCounter;
             bool _owned;
+            std::shared_ptr<const std::byte> _shared; // Set once the memory is shared, see share().
         };
 
         Container b;
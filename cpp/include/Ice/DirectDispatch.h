@@ -0,0 +1,69 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_DIRECT_DISPATCH_H
+#define ICE_DIRECT_DISPATCH_H
+
+#include "Current.h"
+#include "InstanceF.h"
+#include "Object.h"
+#include "Proxy.h"
+#include "UserException.h"
+
+#include <exception>
+#include <functional>
+#include <string_view>
+
+namespace Ice
+{
+    class ObjectAdapterI;
+}
+
+namespace IceInternal
+{
+    class LoggerMiddleware;
+
+    // The generated code uses this class to call the servant of an operation with the "cpp:direct-collocation"
+    // metadata directly, without marshaling the request and the response. A direct call is only possible for a twoway
+    // invocation on a proxy whose cached request handler is collocated, when the dispatch pipeline of the object
+    // adapter is its servant manager, possibly behind the logger middleware if it doesn't trace the dispatches, when
+    // the communicator has no executor or observer and doesn't trace the protocol, and when the object adapter holds a
+    // servant for the target (no servant locator). Otherwise, #servant returns nullptr and the generated code falls
+    // back to the regular invocation.
+    //
+    // The servant receives copies of the in-parameters, except for class instances which are shared with the caller.
+    // The out-parameters and the return value are assigned by the servant, in the caller's variables.
+    class ICE_API DirectDispatch final
+    {
+    public:
+        DirectDispatch(
+            const Ice::ObjectPrx& proxy,
+            std::string_view operation,
+            Ice::OperationMode mode,
+            const Ice::Context& context);
+        ~DirectDispatch();
+
+        DirectDispatch(const DirectDispatch&) = delete;
+        DirectDispatch& operator=(const DirectDispatch&) = delete;
+
+        // Returns the servant that can be called directly, or nullptr if the invocation must be marshaled.
+        template<typename T> [[nodiscard]] T* servant() const noexcept { return dynamic_cast<T*>(_servant.get()); }
+
+        // The Current object of the direct call.
+        [[nodiscard]] const Ice::Current& current() const noexcept { return _current; }
+
+        // Throws the exception the caller would receive if the servant had thrown this exception during a regular
+        // collocated invocation. The userException function throws the user exceptions declared by the operation, the
+        // other user exceptions are reported as UnknownUserException.
+        [[noreturn]] void
+        rethrow(std::exception_ptr, const std::function<void(const Ice::UserException&)>& userException) const;
+
+    private:
+        IceInternal::InstancePtr _instance;
+        std::shared_ptr<Ice::ObjectAdapterI> _adapter; // set once the direct count of the adapter is incremented.
+        std::shared_ptr<LoggerMiddleware> _loggerMiddleware;
+        Ice::ObjectPtr _servant;
+        Ice::Current _current;
+    };
+}
+
+#endif
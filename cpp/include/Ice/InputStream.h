@@ -10,6 +10,7 @@
 #include "LocalException.h"
 #include "Logger.h"
 #include "ReferenceF.h"
+#include "SharedByteSeq.h"
 #include "SlicedDataF.h"
 #include "StreamableTraits.h"
 #include "UserExceptionFactory.h"
@@ -19,6 +20,7 @@
 #include <cassert>
 #include <cstdint>
 #include <map>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 
@@ -129,6 +131,25 @@ namespace Ice
         /// @return The previous closure, or nullptr.
         void* setClosure(void* p);
 
+        /// @endcond
+
+        /// Gets the memory resource used to construct the std::pmr strings and containers created while reading from
+        /// this stream.
+        /// @return The memory resource set with #setMemoryResource, or the default memory resource.
+        [[nodiscard]] std::pmr::memory_resource* getMemoryResource() const noexcept
+        {
+            return _memoryResource ? _memoryResource : std::pmr::get_default_resource();
+        }
+
+        /// Sets the memory resource used to construct the std::pmr strings and containers created while reading from
+        /// this stream, such as a std::pmr::monotonic_buffer_resource that outlives the unmarshaled values. This
+        /// resource is only used for the new elements of the sequences and dictionaries that don't have a
+        /// polymorphic allocator: the strings and containers read from the stream keep their own allocator.
+        /// @param resource The memory resource, or nullptr to use the default memory resource.
+        void setMemoryResource(std::pmr::memory_resource* resource) noexcept { _memoryResource = resource; }
+
+        /// @cond INTERNAL
+
         void resetEncapsulation();
 
         /// Resizes the stream to a new size.
@@ -456,6 +477,11 @@ namespace Ice
         /// sequence elements.
         void read(std::pair<const std::byte*, const std::byte*>& v);
 
+        /// Reads a sequence of bytes from the stream.
+        /// @param[out] v A shared sequence that refers to the internal marshaling buffer and keeps it alive, or a
+        /// copy of the bytes when the buffer of this stream can't be shared.
+        void read(SharedByteSeq& v);
+
         /// Reads a bool from the stream.
         /// @param[out] v The extracted bool.
         void read(bool& v)
@@ -539,6 +565,12 @@ namespace Ice
         /// communicator), `false` otherwise.
         void read(std::vector<std::string>& v, bool convert = true);
 
+        /// Reads a string from the stream into a std::pmr::string. The string keeps its allocator.
+        /// @param[out] v The unmarshaled string.
+        /// @param convert `true` to process the unmarshaled string through the string converter (if installed on the
+        /// communicator), `false` otherwise.
+        void read(std::pmr::string& v, bool convert = true);
+
         /// @cond INTERNAL
 
         /// Reads a wide string from the stream.
@@ -920,6 +952,8 @@ namespace Ice
 
         void* _closure;
 
+        std::pmr::memory_resource* _memoryResource;
+
         int _startSeq;
         int _minSeqSize;
 
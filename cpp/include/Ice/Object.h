@@ -7,6 +7,7 @@
 #include "ObjectF.h"
 #include "OutgoingResponse.h"
 
+#include <cstdint>
 #include <functional>
 #include <string_view>
 
@@ -165,4 +166,22 @@ namespace Ice
     };
 }
 
+namespace IceInternal
+{
+    /// Computes the 64-bit FNV-1a hash of an operation name. The dispatch functions generated by slice2cpp switch on
+    /// this hash to find the target operation.
+    /// @param operation The operation name.
+    /// @return The hash of @p operation.
+    constexpr std::uint64_t operationHash(std::string_view operation) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (char c : operation)
+        {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+}
+
 #endif
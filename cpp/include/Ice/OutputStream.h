@@ -10,6 +10,7 @@
 #include "Ice/Version.h"
 #include "Ice/VersionFunctions.h"
 #include "InstanceF.h"
+#include "SharedByteSeq.h"
 #include "SlicedDataF.h"
 #include "StreamableTraits.h"
 #include "ValueF.h"
@@ -18,6 +19,7 @@
 #include <cstdint>
 #include <cstring>
 #include <map>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -495,6 +497,10 @@ namespace Ice
         /// @param end The end of the sequence.
         void write(const std::uint8_t* start, const std::uint8_t* end);
 
+        /// Writes a byte sequence to the stream.
+        /// @param v The byte sequence.
+        void write(const SharedByteSeq& v) { write(v.begin(), v.end()); }
+
         /// Writes a boolean sequence to the stream.
         /// @param begin The beginning of the sequence.
         /// @param end The end of the sequence.
@@ -531,6 +537,12 @@ namespace Ice
         /// @p v as-is.
         void write(const std::string& v, bool convert = true) { write(std::string_view(v), convert); }
 
+        /// Writes a string to the stream.
+        /// @param v The string to marshal.
+        /// @param convert `true` to process @p v through the narrow string converter (if not null), `false` to write
+        /// @p v as-is.
+        void write(const std::pmr::string& v, bool convert = true) { write(std::string_view(v), convert); }
+
         /// Writes a string view to the stream.
         /// @param v The string view to marshal.
         /// @param convert `true` to process @p v through the narrow string converter (if not null), `false` to write
@@ -0,0 +1,153 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHARED_BYTE_SEQ_H
+#define ICE_SHARED_BYTE_SEQ_H
+
+#include "Config.h"
+#include "StreamableTraits.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace Ice
+{
+    /// A read-only sequence of bytes that shares ownership of the memory it refers to.
+    /// When unmarshaled from a protocol message received over a connection, a SharedByteSeq refers directly to the
+    /// memory of this message and keeps this memory alive for as long as the SharedByteSeq or one of its copies is
+    /// alive. You can therefore keep a SharedByteSeq past the end of a dispatch or of a response callback without
+    /// copying the bytes.
+    /// Use the metadata `cpp:type:Ice::SharedByteSeq` on a `sequence<byte>` type, parameter or field to map it to this
+    /// type.
+    /// @remark A SharedByteSeq keeps the memory of the entire message alive, not just the memory of its bytes. Copy the
+    /// bytes into a vector if you keep a small sequence from a large message for a long time.
+    /// @headerfile Ice/Ice.h
+    class SharedByteSeq
+    {
+    public:
+        using value_type = std::byte;
+        using const_iterator = const std::byte*;
+        using iterator = const_iterator;
+        using size_type = std::size_t;
+
+        /// Constructs an empty sequence.
+        SharedByteSeq() noexcept = default;
+
+        /// Constructs a sequence that takes ownership of the bytes of a vector.
+        /// @param bytes The bytes.
+        SharedByteSeq(std::vector<std::byte> bytes) // NOLINT(google-explicit-constructor)
+        {
+            if (!bytes.empty())
+            {
+                auto owner = std::make_shared<std::vector<std::byte>>(std::move(bytes));
+                _data = owner->data();
+                _size = owner->size();
+                _owner = std::shared_ptr<const std::byte>(std::move(owner), _data);
+            }
+        }
+
+        /// Constructs a sequence that refers to memory owned by another object.
+        /// @param owner The owner of the memory. It is kept alive by the new sequence and its copies.
+        /// @param data The start of the bytes.
+        /// @param size The number of bytes.
+        SharedByteSeq(std::shared_ptr<const std::byte> owner, const std::byte* data, size_type size) noexcept
+            : _owner(std::move(owner)),
+              _data(data),
+              _size(size)
+        {
+            assert(_owner || _size == 0);
+        }
+
+        /// Gets a pointer to the first byte.
+        /// @return A pointer to the first byte, or nullptr if the sequence is empty.
+        [[nodiscard]] const std::byte* data() const noexcept { return _data; }
+
+        /// Gets the number of bytes.
+        /// @return The number of bytes.
+        [[nodiscard]] size_type size() const noexcept { return _size; }
+
+        /// Determines whether this sequence is empty.
+        /// @return `true` if the sequence is empty, `false` otherwise.
+        [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+
+        /// Gets an iterator to the first byte.
+        /// @return An iterator to the first byte.
+        [[nodiscard]] const_iterator begin() const noexcept { return _data; }
+
+        /// Gets an iterator past the last byte.
+        /// @return An iterator past the last byte.
+        [[nodiscard]] const_iterator end() const noexcept { return _data + _size; }
+
+        /// Gets the byte at the given position.
+        /// @param n The position.
+        /// @return The byte.
+        const std::byte& operator[](size_type n) const noexcept
+        {
+            assert(n < _size);
+            return _data[n];
+        }
+
+        /// Gets a sequence that refers to a part of this sequence and shares its memory.
+        /// @param pos The position of the first byte.
+        /// @param count The number of bytes.
+        /// @return The new sequence.
+        [[nodiscard]] SharedByteSeq subseq(size_type pos, size_type count) const noexcept
+        {
+            assert(pos <= _size && count <= _size - pos);
+            return count == 0 ? SharedByteSeq{} : SharedByteSeq{_owner, _data + pos, count};
+        }
+
+        /// Copies the bytes into a vector.
+        /// @return A vector with a copy of the bytes.
+        [[nodiscard]] std::vector<std::byte> toVector() const { return {begin(), end()}; }
+
+        /// Compares the bytes of two sequences.
+        /// @param rhs The sequence to compare with.
+        /// @return `true` if the sequences hold the same bytes, `false` otherwise.
+        bool operator==(const SharedByteSeq& rhs) const noexcept
+        {
+            return _size == rhs._size && std::equal(begin(), end(), rhs.begin());
+        }
+
+        /// Compares the bytes of two sequences.
+        /// @param rhs The sequence to compare with.
+        /// @return `true` if the sequences hold different bytes, `false` otherwise.
+        bool operator!=(const SharedByteSeq& rhs) const noexcept { return !operator==(rhs); }
+
+    private:
+        std::shared_ptr<const std::byte> _owner;
+        const std::byte* _data{nullptr};
+        size_type _size{0};
+    };
+
+    /// Outputs the bytes of a SharedByteSeq to a stream.
+    /// @param os The output stream.
+    /// @param v The sequence.
+    /// @return The output stream.
+    inline std::ostream& operator<<(std::ostream& os, const SharedByteSeq& v)
+    {
+        os << '[';
+        for (auto p = v.begin(); p != v.end(); ++p)
+        {
+            if (p != v.begin())
+            {
+                os << ", ";
+            }
+            os << static_cast<int>(*p);
+        }
+        return os << ']';
+    }
+
+    /// Specialization for SharedByteSeq, marshaled as a sequence of bytes.
+    template<> struct StreamableTraits<SharedByteSeq>
+    {
+        static constexpr StreamHelperCategory helper = StreamHelperCategoryBuiltin;
+        static constexpr int minWireSize = 1;
+        static constexpr bool fixedLength = false;
+    };
+}
+
+#endif
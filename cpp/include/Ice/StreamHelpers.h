@@ -7,6 +7,7 @@
 #include "OutputStream.h"
 #include "StringConverter.h"
 
+#include <cstring>
 #include <iterator>
 #include <ostream>
 
@@ -20,6 +21,35 @@
 #    include <span>
 #endif
 
+namespace IceInternal
+{
+    // Determines whether a container allocates its memory with a std::pmr::polymorphic_allocator.
+    template<typename T, typename = void> struct UsesPolymorphicAllocator : std::false_type
+    {
+    };
+
+    template<typename T>
+    struct UsesPolymorphicAllocator<T, std::void_t<typename T::allocator_type>>
+        : std::is_same<typename T::allocator_type, std::pmr::polymorphic_allocator<typename T::value_type>>
+    {
+    };
+
+    // Creates an empty value that allocates its memory from the given memory resource, if it's a std::pmr string or
+    // container. Other values are default-constructed. The value is returned as a prvalue: it's constructed in place
+    // and keeps the memory resource.
+    template<typename T> T makeWithMemoryResource(std::pmr::memory_resource* resource)
+    {
+        if constexpr (std::uses_allocator_v<T, std::pmr::polymorphic_allocator<std::byte>>)
+        {
+            return T(typename T::allocator_type{resource});
+        }
+        else
+        {
+            return T();
+        }
+    }
+}
+
 namespace Ice
 {
     // StreamHelper templates used by streams to read, write and print data.
@@ -219,11 +249,49 @@ namespace Ice
     /// Reader used/generated for structs. Always specialized.
     template<typename T> struct StreamReader;
 
+    /// Determines whether a struct is marshaled by copying its memory representation: all its fields are fixed-size
+    /// integral or floating-point values (see StreamableTraits<T>::fixedSizeNumeric), its C++ mapping has no padding,
+    /// and the host is little-endian like the Ice encoding.
+    template<typename T, typename = void> struct IsBulkCopyable : std::false_type
+    {
+    };
+
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    /// @private
+    template<typename T>
+    struct IsBulkCopyable<T, std::enable_if_t<StreamableTraits<T>::fixedSizeNumeric>>
+        : std::bool_constant<std::is_trivially_copyable_v<T> && sizeof(T) == StreamableTraits<T>::minWireSize>
+    {
+    };
+#endif
+
     template<typename T> struct StreamHelper<T, StreamHelperCategoryStruct>
     {
-        static void write(OutputStream* stream, const T& v) { stream->writeAll(v.ice_tuple()); }
+        static void write(OutputStream* stream, const T& v)
+        {
+            if constexpr (IsBulkCopyable<T>::value)
+            {
+                stream->writeBlob(reinterpret_cast<const std::byte*>(&v), sizeof(T));
+            }
+            else
+            {
+                stream->writeAll(v.ice_tuple());
+            }
+        }
 
-        static void read(InputStream* stream, T& v) { StreamReader<T>::read(stream, v); }
+        static void read(InputStream* stream, T& v)
+        {
+            if constexpr (IsBulkCopyable<T>::value)
+            {
+                const std::byte* data;
+                stream->readBlob(data, sizeof(T));
+                memcpy(&v, data, sizeof(T));
+            }
+            else
+            {
+                StreamReader<T>::read(stream, v);
+            }
+        }
 
         static void print(std::ostream& stream, const T& v) { stream << v; }
     };
@@ -253,24 +321,81 @@ namespace Ice
         static void print(std::ostream& stream, T v) { stream << v; }
     };
 
+    /// Determines whether a container is a std::vector.
+    template<typename T> struct IsVector : std::false_type
+    {
+    };
+
+    /// @private
+    template<typename T, typename A> struct IsVector<std::vector<T, A>> : std::true_type
+    {
+    };
+
     template<typename T> struct StreamHelper<T, StreamHelperCategorySequence>
     {
         static void write(OutputStream* stream, const T& v)
         {
             stream->writeSize(static_cast<std::int32_t>(v.size()));
-            for (const auto& element : v)
+            if constexpr (IsVector<T>::value && IsBulkCopyable<typename T::value_type>::value)
+            {
+                // The elements are contiguous and encoded as is, we marshal them with a single copy.
+                stream->writeBlob(
+                    reinterpret_cast<const std::byte*>(v.data()),
+                    v.size() * sizeof(typename T::value_type));
+            }
+            else
             {
-                stream->write(element);
+                for (const auto& element : v)
+                {
+                    stream->write(element);
+                }
             }
         }
 
         static void read(InputStream* stream, T& v)
         {
-            std::int32_t sz = stream->readAndCheckSeqSize(StreamableTraits<typename T::value_type>::minWireSize);
-            T(static_cast<size_t>(sz)).swap(v);
-            for (auto& element : v)
+            using E = typename T::value_type;
+            std::int32_t sz = stream->readAndCheckSeqSize(StreamableTraits<E>::minWireSize);
+            if constexpr (IceInternal::UsesPolymorphicAllocator<T>::value)
+            {
+                // The container keeps its allocator, which it also uses to construct the new elements.
+                v.clear();
+                v.resize(static_cast<size_t>(sz));
+            }
+            else if constexpr (std::uses_allocator_v<E, std::pmr::polymorphic_allocator<std::byte>>)
+            {
+                // The new std::pmr elements allocate their memory from the memory resource of the stream.
+                v.clear();
+                if constexpr (IsVector<T>::value)
+                {
+                    v.reserve(static_cast<size_t>(sz));
+                }
+                while (sz--)
+                {
+                    v.push_back(IceInternal::makeWithMemoryResource<E>(stream->getMemoryResource()));
+                    stream->read(v.back());
+                }
+                return;
+            }
+            else
             {
-                stream->read(element);
+                T(static_cast<size_t>(sz)).swap(v);
+            }
+            if constexpr (IsVector<T>::value && IsBulkCopyable<typename T::value_type>::value)
+            {
+                const std::byte* data;
+                stream->readBlob(data, v.size() * sizeof(typename T::value_type));
+                if (!v.empty())
+                {
+                    memcpy(v.data(), data, v.size() * sizeof(typename T::value_type));
+                }
+            }
+            else
+            {
+                for (auto& element : v)
+                {
+                    stream->read(element);
+                }
             }
         }
 
@@ -328,12 +453,38 @@ namespace Ice
         {
             std::int32_t sz = stream->readSize();
             v.clear();
-            while (sz--)
+            if constexpr (
+                IceInternal::UsesPolymorphicAllocator<T>::value ||
+                std::uses_allocator_v<typename T::key_type, std::pmr::polymorphic_allocator<std::byte>> ||
+                std::uses_allocator_v<typename T::mapped_type, std::pmr::polymorphic_allocator<std::byte>>)
             {
-                typename T::value_type p;
-                stream->read(const_cast<typename T::key_type&>(p.first));
-                auto i = v.insert(v.end(), p);
-                stream->read(i->second);
+                // The dictionary keeps its allocator. The new std::pmr keys and values allocate their memory from the
+                // memory resource of the dictionary, or from the memory resource of the stream otherwise.
+                std::pmr::memory_resource* resource = stream->getMemoryResource();
+                if constexpr (IceInternal::UsesPolymorphicAllocator<T>::value)
+                {
+                    resource = v.get_allocator().resource();
+                }
+                while (sz--)
+                {
+                    auto key = IceInternal::makeWithMemoryResource<typename T::key_type>(resource);
+                    stream->read(key);
+                    auto i = v.emplace_hint(
+                        v.end(),
+                        std::move(key),
+                        IceInternal::makeWithMemoryResource<typename T::mapped_type>(resource));
+                    stream->read(i->second);
+                }
+            }
+            else
+            {
+                while (sz--)
+                {
+                    typename T::value_type p;
+                    stream->read(const_cast<typename T::key_type&>(p.first));
+                    auto i = v.insert(v.end(), p);
+                    stream->read(i->second);
+                }
             }
         }
 
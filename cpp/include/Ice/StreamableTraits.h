@@ -232,6 +232,13 @@ namespace Ice
         static constexpr bool fixedLength = false;
     };
 
+    template<> struct StreamableTraits<std::pmr::string>
+    {
+        static constexpr StreamHelperCategory helper = StreamHelperCategoryBuiltin;
+        static constexpr int minWireSize = 1;
+        static constexpr bool fixedLength = false;
+    };
+
     template<> struct StreamableTraits<std::string_view>
     {
         static constexpr StreamHelperCategory helper = StreamHelperCategoryBuiltinValue;
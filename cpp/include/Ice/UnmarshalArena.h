@@ -0,0 +1,47 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_UNMARSHAL_ARENA_H
+#define ICE_UNMARSHAL_ARENA_H
+
+#include "InputStream.h"
+#include "StreamHelpers.h"
+
+#include <algorithm>
+#include <memory_resource>
+
+namespace IceInternal
+{
+    // The generated code uses this class to unmarshal the parameters of operations with the "cpp:arena" metadata. The
+    // std::pmr parameters are constructed with a monotonic arena (see makeWithMemoryResource), which is also used by
+    // the std::pmr elements added to their sequences and dictionaries. The arena is released all at once when it's
+    // destroyed at the end of the dispatch.
+    //
+    // The unmarshaled parameters must not outlive the dispatch: std::pmr strings and containers keep their memory
+    // resource when they are moved, so a parameter moved into a data member by the servant dangles once the dispatch
+    // returns. The servant must copy it instead, as a copy uses the default memory resource.
+    class UnmarshalArena final
+    {
+    public:
+        // Must be called after startEncapsulation: the size of the encapsulation is a good estimate of the memory
+        // needed by the unmarshaled parameters.
+        explicit UnmarshalArena(Ice::InputStream* stream)
+            : _stream(stream),
+              _resource(std::max(static_cast<std::size_t>(stream->getEncapsulationSize()), MinInitialSize))
+        {
+            _stream->setMemoryResource(&_resource);
+        }
+
+        ~UnmarshalArena() { _stream->setMemoryResource(nullptr); }
+
+        UnmarshalArena(const UnmarshalArena&) = delete;
+        UnmarshalArena& operator=(const UnmarshalArena&) = delete;
+
+    private:
+        static constexpr std::size_t MinInitialSize = 256;
+
+        Ice::InputStream* const _stream;
+        std::pmr::monotonic_buffer_resource _resource;
+    };
+}
+
+#endif
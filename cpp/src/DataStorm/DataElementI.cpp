@@ -30,19 +30,11 @@ namespace
     }
 
     void cleanOldSamples(
-        deque<shared_ptr<Sample>>& samples,
+        SampleQueue& samples,
         const chrono::time_point<chrono::system_clock>& now,
         int lifetime)
     {
-        chrono::time_point<chrono::system_clock> staleTime = now - chrono::milliseconds(lifetime);
-        auto p = stable_partition(
-            samples.begin(),
-            samples.end(),
-            [&](const shared_ptr<Sample>& s) { return s->timestamp < staleTime; });
-        if (p != samples.begin())
-        {
-            samples.erase(samples.begin(), p);
-        }
+        samples.removeStaleSamples(now - chrono::milliseconds(lifetime));
     }
 }
 
@@ -681,6 +673,11 @@ DataReaderI::DataReaderI(
       _parent(topic),
       _discardPolicy(config.discardPolicy ? *config.discardPolicy : DataStorm::DiscardPolicy::None)
 {
+    if (config.sampleCount && *config.sampleCount > 0)
+    {
+        _samples.setMaxSize(static_cast<size_t>(*config.sampleCount));
+    }
+
     if (!sampleFilterName.empty())
     {
         _config->sampleFilter =
@@ -699,8 +696,8 @@ vector<shared_ptr<Sample>>
 DataReaderI::getAllUnread()
 {
     lock_guard<mutex> lock(_parent->_mutex);
-    vector<shared_ptr<Sample>> unread(_samples.begin(), _samples.end());
-    _samples.clear();
+    vector<shared_ptr<Sample>> unread = _samples.take();
+    decodeSamples(unread);
     return unread;
 }
 
@@ -735,8 +732,8 @@ DataReaderI::getNextUnread()
             _parent->instance()->checkShutdown();
             return !_samples.empty();
         });
-    shared_ptr<Sample> sample = _samples.front();
-    _samples.pop_front();
+    shared_ptr<Sample> sample = _samples.pop_front();
+    decodeSample(sample);
     return sample;
 }
 
@@ -776,16 +773,16 @@ DataReaderI::initSamples(
         assert(sample->key);
         valid.push_back(sample);
 
-        if (!sample->hasValue())
+        // Partial updates are computed from the previous sample, the other samples are decoded when the application
+        // reads them.
+        if (sample->event == DataStorm::SampleEvent::PartialUpdate && !sample->hasValue())
         {
-            if (sample->event == DataStorm::SampleEvent::PartialUpdate)
-            {
-                _parent->getUpdater(sample->tag)(previous, sample, _parent->instance()->getCommunicator());
-            }
-            else
-            {
-                sample->decode(_parent->instance()->getCommunicator());
-            }
+            decodeSample(previous);
+            _parent->getUpdater(sample->tag)(previous, sample, _parent->instance()->getCommunicator());
+        }
+        else if (_onSamples)
+        {
+            decodeSample(sample);
         }
         previous = sample;
     }
@@ -914,16 +911,16 @@ DataReaderI::queue(
         return;
     }
 
-    if (!sample->hasValue())
+    // Partial updates are computed from the last sample, the other samples are decoded when the application reads
+    // them.
+    if (sample->event == DataStorm::SampleEvent::PartialUpdate && !sample->hasValue())
     {
-        if (sample->event == DataStorm::SampleEvent::PartialUpdate)
-        {
-            _parent->getUpdater(sample->tag)(_last, sample, _parent->instance()->getCommunicator());
-        }
-        else
-        {
-            sample->decode(_parent->instance()->getCommunicator());
-        }
+        decodeSample(_last);
+        _parent->getUpdater(sample->tag)(_last, sample, _parent->instance()->getCommunicator());
+    }
+    else if (_onSamples)
+    {
+        decodeSample(sample);
     }
     _lastSendTime = sample->timestamp;
 
@@ -982,11 +979,30 @@ DataReaderI::onSamples(
     _onSamples = std::move(update);
     if (init && !_samples.empty())
     {
-        vector<shared_ptr<Sample>> samples(_samples.begin(), _samples.end());
+        vector<shared_ptr<Sample>> samples = _samples.get();
+        decodeSamples(samples);
         _executor->queue([init, samples] { init(samples); }, true);
     }
 }
 
+void
+DataReaderI::decodeSample(const shared_ptr<Sample>& sample) const
+{
+    if (sample && !sample->hasValue())
+    {
+        sample->decode(_parent->instance()->getCommunicator());
+    }
+}
+
+void
+DataReaderI::decodeSamples(const vector<shared_ptr<Sample>>& samples) const
+{
+    for (const auto& sample : samples)
+    {
+        decodeSample(sample);
+    }
+}
+
 bool
 DataReaderI::addConnectedKey(const shared_ptr<Key>& key, const shared_ptr<Subscriber>& subscriber)
 {
@@ -1015,6 +1031,10 @@ DataWriterI::DataWriterI(TopicWriterI* topic, string name, int64_t id, const Dat
       _subscribers{uncheckedCast<DataStormContract::SubscriberSessionPrx>(_forwarder)}
 {
     _config->priority = config.priority;
+    if (config.sampleCount && *config.sampleCount > 0)
+    {
+        _samples.setMaxSize(static_cast<size_t>(*config.sampleCount));
+    }
 }
 
 void
@@ -1214,8 +1234,7 @@ vector<shared_ptr<Sample>>
 KeyDataWriterI::getAll() const
 {
     unique_lock<mutex> lock(_parent->_mutex);
-    vector<shared_ptr<Sample>> all(_samples.begin(), _samples.end());
-    return all;
+    return _samples.get();
 }
 
 string
@@ -1281,21 +1300,22 @@ KeyDataWriterI::getSamples(
     // For each sample:
     // - Check if it matches the optional key and sample filter.
     // - If it matches, add it to the result set and update the first matched sample.
-    for (auto p = _samples.rbegin(); p != _samples.rend(); ++p)
+    for (size_t i = _samples.size(); i-- > 0;)
     {
-        if ((*p)->timestamp < staleTime)
+        const shared_ptr<Sample>& sample = _samples[i];
+        if (sample->timestamp < staleTime)
         {
             break;
         }
-        if ((*p)->id <= lastId)
+        if (sample->id <= lastId)
         {
             break;
         }
 
-        if ((!key || key == (*p)->key) && (!sampleFilter || sampleFilter->match(*p)))
+        if ((!key || key == sample->key) && (!sampleFilter || sampleFilter->match(sample)))
         {
-            first = *p;
-            samples.samples.push_front(toSample(*p, getCommunicator(), _keys.empty()));
+            first = sample;
+            samples.samples.push_front(toSample(sample, getCommunicator(), _keys.empty()));
             if (config->sampleCount && *config->sampleCount > 0 &&
                 static_cast<size_t>(*config->sampleCount) == samples.samples.size())
             {
@@ -1304,10 +1324,10 @@ KeyDataWriterI::getSamples(
 
             if (config->clearHistory &&
                 (*config->clearHistory == ClearHistoryPolicy::OnAll ||
-                 ((*p)->event == DataStorm::SampleEvent::Add && *config->clearHistory == ClearHistoryPolicy::OnAdd) ||
-                 ((*p)->event == DataStorm::SampleEvent::Remove &&
+                 (sample->event == DataStorm::SampleEvent::Add && *config->clearHistory == ClearHistoryPolicy::OnAdd) ||
+                 (sample->event == DataStorm::SampleEvent::Remove &&
                   *config->clearHistory == ClearHistoryPolicy::OnRemove) ||
-                 ((*p)->event != DataStorm::SampleEvent::PartialUpdate &&
+                 (sample->event != DataStorm::SampleEvent::PartialUpdate &&
                   *config->clearHistory == ClearHistoryPolicy::OnAllExceptPartialUpdate)))
             {
                 break;
@@ -5,6 +5,7 @@
 
 #include "DataStorm/Contract.h"
 #include "DataStorm/InternalI.h"
+#include "SampleQueue.h"
 
 #if defined(__clang__)
 #    pragma clang diagnostic push
@@ -373,9 +374,13 @@ namespace DataStormI
         [[nodiscard]] virtual bool matchKey(const std::shared_ptr<Key>&) const = 0;
         [[nodiscard]] bool addConnectedKey(const std::shared_ptr<Key>&, const std::shared_ptr<Subscriber>&) override;
 
+        // Decode the value of the given samples, the samples are decoded when they are handed to the application.
+        void decodeSample(const std::shared_ptr<Sample>&) const;
+        void decodeSamples(const std::vector<std::shared_ptr<Sample>>&) const;
+
         TopicReaderI* _parent;
 
-        std::deque<std::shared_ptr<Sample>> _samples;
+        SampleQueue _samples;
         std::shared_ptr<Sample> _last;
         int _instanceCount;
         DataStorm::DiscardPolicy _discardPolicy;
@@ -395,7 +400,7 @@ namespace DataStormI
 
         TopicWriterI* _parent;
         DataStormContract::SubscriberSessionPrx _subscribers;
-        std::deque<std::shared_ptr<Sample>> _samples;
+        SampleQueue _samples;
         std::shared_ptr<Sample> _last;
     };
 
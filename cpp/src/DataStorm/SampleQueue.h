@@ -0,0 +1,150 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef DATASTORM_SAMPLE_QUEUE_H
+#define DATASTORM_SAMPLE_QUEUE_H
+
+#include "DataStorm/InternalI.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace DataStormI
+{
+    // The sample history of a data reader or data writer, ordered from the oldest to the newest sample.
+    //
+    // The samples are stored in a ring buffer: queueing and evicting samples doesn't allocate memory once the buffer
+    // is large enough, and the samples are kept in a contiguous array. The buffer grows geometrically up to the
+    // maximum size set with setMaxSize, which the owner of the queue sets from the sampleCount configuration.
+    class SampleQueue
+    {
+    public:
+        // Sets the maximum number of samples the owner of the queue keeps, 0 means unbounded.
+        void setMaxSize(std::size_t maxSize) noexcept { _maxSize = maxSize; }
+
+        [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+        // Returns the sample at the given position, 0 is the oldest sample.
+        [[nodiscard]] const std::shared_ptr<Sample>& operator[](std::size_t pos) const noexcept
+        {
+            assert(pos < _size);
+            return _buffer[index(pos)];
+        }
+
+        [[nodiscard]] const std::shared_ptr<Sample>& front() const noexcept { return (*this)[0]; }
+        [[nodiscard]] const std::shared_ptr<Sample>& back() const noexcept { return (*this)[_size - 1]; }
+
+        void push_back(std::shared_ptr<Sample> sample)
+        {
+            if (_size == _buffer.size())
+            {
+                grow();
+            }
+            _buffer[index(_size)] = std::move(sample);
+            ++_size;
+        }
+
+        std::shared_ptr<Sample> pop_front() noexcept
+        {
+            assert(_size > 0);
+            std::shared_ptr<Sample> sample = std::move(_buffer[_head]);
+            _head = index(1);
+            --_size;
+            return sample;
+        }
+
+        void clear() noexcept
+        {
+            while (_size > 0)
+            {
+                pop_front();
+            }
+            _head = 0;
+        }
+
+        // Returns a copy of the queued samples.
+        [[nodiscard]] std::vector<std::shared_ptr<Sample>> get() const
+        {
+            std::vector<std::shared_ptr<Sample>> samples;
+            samples.reserve(_size);
+            for (std::size_t i = 0; i < _size; ++i)
+            {
+                samples.push_back(_buffer[index(i)]);
+            }
+            return samples;
+        }
+
+        // Removes and returns the queued samples.
+        [[nodiscard]] std::vector<std::shared_ptr<Sample>> take()
+        {
+            std::vector<std::shared_ptr<Sample>> samples;
+            samples.reserve(_size);
+            while (_size > 0)
+            {
+                samples.push_back(pop_front());
+            }
+            _head = 0;
+            return samples;
+        }
+
+        // Removes the samples older than the given stale time, preserving the order of the remaining samples.
+        void removeStaleSamples(const std::chrono::time_point<std::chrono::system_clock>& staleTime) noexcept
+        {
+            // The samples are compacted towards the back of the queue, the stale samples are usually the oldest ones
+            // so in the common case no sample is moved.
+            std::size_t kept = 0;
+            for (std::size_t i = _size; i-- > 0;)
+            {
+                std::shared_ptr<Sample>& sample = _buffer[index(i)];
+                if (sample->timestamp < staleTime)
+                {
+                    sample = nullptr;
+                }
+                else
+                {
+                    ++kept;
+                    if (kept != _size - i)
+                    {
+                        _buffer[index(_size - kept)] = std::move(sample);
+                    }
+                }
+            }
+            _head = index(_size - kept);
+            _size = kept;
+        }
+
+    private:
+        [[nodiscard]] std::size_t index(std::size_t pos) const noexcept
+        {
+            std::size_t i = _head + pos;
+            return i < _buffer.size() ? i : i - _buffer.size();
+        }
+
+        void grow()
+        {
+            std::size_t capacity = std::max<std::size_t>(16, _buffer.size() * 2);
+            if (_maxSize > 0)
+            {
+                capacity = std::max(std::min(capacity, _maxSize), _buffer.size() + 1);
+            }
+
+            std::vector<std::shared_ptr<Sample>> buffer(capacity);
+            for (std::size_t i = 0; i < _size; ++i)
+            {
+                buffer[i] = std::move(_buffer[index(i)]);
+            }
+            _buffer.swap(buffer);
+            _head = 0;
+        }
+
+        std::vector<std::shared_ptr<Sample>> _buffer;
+        std::size_t _head{0};
+        std::size_t _size{0};
+        std::size_t _maxSize{0};
+    };
+}
+
+#endif
@@ -1,7 +1,9 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Blobject.h"
+#include "../Ice/ForwardAsync.h"
 #include "Instrumentation.h"
+#include "RequestQueue.h"
 #include "SessionRouterI.h"
 
 using namespace std;
@@ -31,13 +33,11 @@ Glacier2::Blobject::Blobject(shared_ptr<Instance> instance, ConnectionPtr revers
 }
 
 void
-Glacier2::Blobject::invoke(
-    ObjectPrx& proxy,
-    pair<const byte*, const byte*> inParams,
-    function<void(bool, pair<const byte*, const byte*>)> response,
-    function<void(exception_ptr)> exception, // NOLINT(performance-unnecessary-value-param)
-    const Current& current)
+Glacier2::Blobject::dispatch(IncomingRequest& request, function<void(OutgoingResponse)> sendResponse)
 {
+    const Current& current = request.current();
+    ObjectPrx proxy = getTarget(current);
+
     //
     // Set the correct facet on the proxy.
     //
@@ -153,77 +153,43 @@ Glacier2::Blobject::invoke(
         }
     }
 
-    try
+    //
+    // The request is forwarded without copying its encapsulation when possible. For oneway requests, the dispatch
+    // completes only once the request has been forwarded (sent). This ensures proper flow control / back pressure
+    // through the Glacier2 router.
+    //
+    Context ctx;
+    const Context* context = &noExplicitContext;
+    if (_forwardContext)
     {
-        function<void(bool, pair<const byte*, const byte*>)> amiResponse = nullptr;
-        function<void(bool)> amiSent = nullptr;
-
-        if (proxy->ice_isTwoway())
+        if (_context.size() > 0)
         {
-            amiResponse = std::move(response);
+            ctx = current.ctx;
+            ctx.insert(_context.begin(), _context.end());
+            context = &ctx;
         }
         else
         {
-            // For oneway requests, we want the dispatch to complete only once the request has been forwarded (sent).
-            // This ensures proper flow control / back pressure through the Glacier2 router.
-            amiSent = [amdResponse = std::move(response)](bool) { amdResponse(true, {nullptr, nullptr}); };
+            context = &current.ctx;
         }
+    }
+    else if (_context.size() > 0)
+    {
+        context = &_context;
+    }
 
-        // We can't move exception because we use it in the catch block below.
-        if (_forwardContext)
-        {
-            if (_context.size() > 0)
-            {
-                Context ctx = current.ctx;
-                ctx.insert(_context.begin(), _context.end());
-                proxy->ice_invokeAsync(
-                    current.operation,
-                    current.mode,
-                    inParams,
-                    std::move(amiResponse),
-                    exception,
-                    std::move(amiSent),
-                    ctx);
-            }
-            else
-            {
-                proxy->ice_invokeAsync(
-                    current.operation,
-                    current.mode,
-                    inParams,
-                    std::move(amiResponse),
-                    exception,
-                    std::move(amiSent),
-                    current.ctx);
-            }
-        }
-        else
+    if (_requestQueue)
+    {
+        //
+        // Oneway requests are queued and forwarded in batches. The queued requests are flushed before forwarding any
+        // other request, to preserve the order of the requests of the session.
+        //
+        if (proxy->ice_isOneway())
         {
-            if (_context.size() > 0)
-            {
-                proxy->ice_invokeAsync(
-                    current.operation,
-                    current.mode,
-                    inParams,
-                    std::move(amiResponse),
-                    exception,
-                    std::move(amiSent),
-                    _context);
-            }
-            else
-            {
-                proxy->ice_invokeAsync(
-                    current.operation,
-                    current.mode,
-                    inParams,
-                    std::move(amiResponse),
-                    exception,
-                    std::move(amiSent));
-            }
+            _requestQueue->addRequest(proxy, request, std::move(sendResponse), *context);
+            return;
         }
+        _requestQueue->flush();
     }
-    catch (const LocalException&)
-    {
-        exception(current_exception());
-    }
+    IceInternal::forwardAsync(proxy, request, std::move(sendResponse), *context);
 }
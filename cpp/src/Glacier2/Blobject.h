@@ -8,22 +8,26 @@
 
 namespace Glacier2
 {
-    class Blobject : public Ice::BlobjectArrayAsync, public std::enable_shared_from_this<Blobject>
+    class RequestQueue;
+
+    // Forwards the requests it dispatches to their target, see getTarget.
+    class Blobject : public Ice::Object, public std::enable_shared_from_this<Blobject>
     {
     public:
         Blobject(std::shared_ptr<Instance>, Ice::ConnectionPtr, Ice::Context);
 
+        void dispatch(Ice::IncomingRequest&, std::function<void(Ice::OutgoingResponse)>) final;
+
     protected:
-        void invoke(
-            Ice::ObjectPrx&,
-            std::pair<const std::byte*, const std::byte*>,
-            std::function<void(bool, std::pair<const std::byte*, const std::byte*>)>,
-            std::function<void(std::exception_ptr)>,
-            const Ice::Current&);
+        // Returns the proxy to forward the request to. Throws an exception if the request can't be forwarded.
+        virtual Ice::ObjectPrx getTarget(const Ice::Current&) = 0;
 
         const std::shared_ptr<Instance> _instance;
         const Ice::ConnectionPtr _reverseConnection;
 
+        // The queue used to batch the oneway requests, nullptr if batching is disabled.
+        std::shared_ptr<RequestQueue> _requestQueue;
+
     private:
         const bool _forwardContext;
         const int _requestTraceLevel;
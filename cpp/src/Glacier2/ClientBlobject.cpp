@@ -4,6 +4,7 @@
 #include "../Ice/CheckIdentity.h"
 #include "FilterManager.h"
 #include "FilterT.h"
+#include "RequestQueue.h"
 #include "RoutingTable.h"
 
 using namespace std;
@@ -22,14 +23,23 @@ Glacier2::ClientBlobject::ClientBlobject(
       _filters(std::move(filters)),
       _rejectTraceLevel(_instance->properties()->getIcePropertyAsInt("Glacier2.Client.Trace.Reject"))
 {
+    if (_instance->timer())
+    {
+        _requestQueue = make_shared<RequestQueue>(_instance);
+    }
 }
 
 void
-Glacier2::ClientBlobject::ice_invokeAsync(
-    pair<const byte*, const byte*> inParams,
-    function<void(bool, pair<const byte*, const byte*>)> response,
-    function<void(exception_ptr)> error,
-    const Current& current)
+Glacier2::ClientBlobject::destroy()
+{
+    if (_requestQueue)
+    {
+        _requestQueue->destroy();
+    }
+}
+
+ObjectPrx
+Glacier2::ClientBlobject::getTarget(const Current& current)
 {
     bool matched = false;
     bool hasFilters = false;
@@ -110,7 +120,7 @@ Glacier2::ClientBlobject::ice_invokeAsync(
         throw ObjectNotExistException{__FILE__, __LINE__};
     }
 
-    invoke(proxy.value(), inParams, std::move(response), std::move(error), current);
+    return proxy.value();
 }
 
 shared_ptr<StringSet>
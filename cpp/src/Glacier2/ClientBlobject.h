@@ -20,16 +20,16 @@ namespace Glacier2
             const Ice::Context&,
             std::shared_ptr<RoutingTable>);
 
-        void ice_invokeAsync(
-            std::pair<const std::byte*, const std::byte*> inEncaps,
-            std::function<void(bool, std::pair<const std::byte*, const std::byte*>)> response,
-            std::function<void(std::exception_ptr)> error,
-            const Ice::Current& current) final;
-
         std::shared_ptr<StringSet> categories();
         std::shared_ptr<StringSet> adapterIds();
         std::shared_ptr<IdentitySet> identities();
 
+        // Flushes the batched requests, the requests forwarded afterwards are no longer batched.
+        void destroy();
+
+    protected:
+        Ice::ObjectPrx getTarget(const Ice::Current&) final;
+
     private:
         const std::shared_ptr<RoutingTable> _routingTable;
         const std::shared_ptr<FilterManager> _filters;
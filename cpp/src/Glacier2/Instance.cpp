@@ -2,6 +2,7 @@
 
 #include "Instance.h"
 #include "../Ice/InstrumentationI.h"
+#include "../Ice/Timer.h"
 #include "InstrumentationI.h"
 #include "SessionRouterI.h"
 
@@ -28,12 +29,22 @@ Glacier2::Instance::Instance(
         const_cast<shared_ptr<Instrumentation::RouterObserver>&>(_observer) =
             make_shared<RouterObserverI>(o->getFacet(), _properties->getIceProperty("Glacier2.InstanceName"));
     }
+
+    if (_properties->getIcePropertyAsInt("Glacier2.Client.Batch.FlushInterval") > 0)
+    {
+        _timer = make_shared<IceInternal::Timer>();
+    }
 }
 
 void
 Glacier2::Instance::destroy()
 {
     _sessionRouter = nullptr;
+
+    if (_timer)
+    {
+        _timer->destroy();
+    }
 }
 
 void
@@ -4,8 +4,10 @@
 #define GLACIER2_INSTANCE_H
 
 #include "Ice/CommunicatorF.h"
+#include "Ice/Config.h"
 #include "Ice/ObjectAdapterF.h"
 #include "Ice/PropertiesF.h"
+#include "Ice/TimerTask.h"
 #include "Instrumentation.h"
 #include "ProxyVerifier.h"
 #include "SessionRouterI.h"
@@ -26,6 +28,9 @@ namespace Glacier2
         [[nodiscard]] std::shared_ptr<ProxyVerifier> proxyVerifier() const { return _proxyVerifier; }
         [[nodiscard]] std::shared_ptr<SessionRouterI> sessionRouter() const { return _sessionRouter; }
 
+        // The timer used to flush the batched client requests, nullptr if batching is disabled.
+        [[nodiscard]] const IceInternal::TimerPtr& timer() const { return _timer; }
+
         [[nodiscard]] const std::shared_ptr<Glacier2::Instrumentation::RouterObserver>& getObserver() const
         {
             return _observer;
@@ -44,6 +49,7 @@ namespace Glacier2
         const std::shared_ptr<ProxyVerifier> _proxyVerifier;
         std::shared_ptr<SessionRouterI> _sessionRouter;
         const std::shared_ptr<Glacier2::Instrumentation::RouterObserver> _observer;
+        IceInternal::TimerPtr _timer;
     };
 
 } // End namespace Glacier2
@@ -0,0 +1,129 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "RequestQueue.h"
+#include "../Ice/ForwardAsync.h"
+#include "../Ice/Timer.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace Glacier2;
+
+Glacier2::RequestQueue::RequestQueue(shared_ptr<Instance> instance)
+    : _instance(std::move(instance)),
+      _flushInterval(_instance->properties()->getIcePropertyAsInt("Glacier2.Client.Batch.FlushInterval")),
+      _maxSize(_instance->properties()->getIcePropertyAsInt("Glacier2.Client.Batch.MaxSize"))
+{
+    assert(_flushInterval > chrono::milliseconds::zero() && _instance->timer());
+}
+
+void
+Glacier2::RequestQueue::addRequest(
+    const ObjectPrx& proxy,
+    IncomingRequest& request,
+    function<void(OutgoingResponse)> sendResponse,
+    const Context& context)
+{
+    auto batchProxy = proxy->ice_batchOneway();
+    bool flushBatches = false;
+    {
+        unique_lock lock(_mutex);
+
+        //
+        // The batch oneway proxy of the target is kept until the next flush: the requests to this target are queued
+        // in the batch request queue of this proxy. If batches of other targets were queued after this one, the
+        // request would be sent before their requests: they are all flushed first and the request starts a new batch.
+        //
+        auto p = find(_batchProxies.begin(), _batchProxies.end(), batchProxy);
+        while (!_destroyed && p != _batchProxies.end() && p + 1 != _batchProxies.end())
+        {
+            lock.unlock();
+            flush();
+            lock.lock();
+            p = find(_batchProxies.begin(), _batchProxies.end(), batchProxy);
+        }
+
+        if (_destroyed)
+        {
+            IceInternal::forwardAsync(proxy, request, std::move(sendResponse), context);
+            return;
+        }
+
+        if (p == _batchProxies.end())
+        {
+            p = _batchProxies.insert(p, std::move(batchProxy));
+        }
+        _size += request.size();
+        IceInternal::forwardAsync(*p, request, std::move(sendResponse), context);
+
+        if (_maxSize > 0 && _size >= _maxSize)
+        {
+            flushBatches = true;
+        }
+        else if (!_scheduled)
+        {
+            try
+            {
+                _instance->timer()->reschedule(shared_from_this(), _flushInterval);
+                _scheduled = true;
+            }
+            catch (const invalid_argument&)
+            {
+                // The timer is destroyed, the router is shutting down.
+                flushBatches = true;
+            }
+        }
+    }
+
+    if (flushBatches)
+    {
+        flush();
+    }
+}
+
+void
+Glacier2::RequestQueue::flush()
+{
+    //
+    // The batches are sent with _mutex unlocked, requests are queued meanwhile in new batches. _flushMutex ensures
+    // these new batches aren't sent before the batches of this flush.
+    //
+    lock_guard flushLock(_flushMutex);
+    vector<ObjectPrx> batchProxies;
+    {
+        lock_guard lock(_mutex);
+        if (_scheduled)
+        {
+            _instance->timer()->cancel(shared_from_this());
+            _scheduled = false;
+        }
+        batchProxies.swap(_batchProxies);
+        _size = 0;
+    }
+
+    for (const auto& proxy : batchProxies)
+    {
+        proxy->ice_flushBatchRequestsAsync(nullptr);
+    }
+}
+
+void
+Glacier2::RequestQueue::destroy()
+{
+    {
+        lock_guard lock(_mutex);
+        _destroyed = true;
+    }
+    flush();
+}
+
+void
+Glacier2::RequestQueue::runTimerTask()
+{
+    {
+        lock_guard lock(_mutex);
+        _scheduled = false;
+    }
+    flush();
+}
@@ -0,0 +1,59 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef GLACIER2_REQUEST_QUEUE_H
+#define GLACIER2_REQUEST_QUEUE_H
+
+#include "Ice/Ice.h"
+#include "Ice/TimerTask.h"
+#include "Instance.h"
+
+#include <mutex>
+#include <vector>
+
+namespace Glacier2
+{
+    //
+    // Coalesces the oneway requests forwarded for a client session into protocol batches. The requests are queued
+    // in the batch request queue of a batch oneway proxy for each target, and the batches are flushed every
+    // Glacier2.Client.Batch.FlushInterval milliseconds, or as soon as Glacier2.Client.Batch.MaxSize bytes of
+    // requests are queued. The batches are flushed in the order of their first request, and a request to a target
+    // whose batch isn't the last one flushes the queued batches first, so the requests are sent in arrival order.
+    //
+    class RequestQueue final : public IceInternal::TimerTask, public std::enable_shared_from_this<RequestQueue>
+    {
+    public:
+        RequestQueue(std::shared_ptr<Instance>);
+
+        // Queues a oneway request in the batch of its target. The dispatch completes once the request is queued.
+        void addRequest(
+            const Ice::ObjectPrx&,
+            Ice::IncomingRequest&,
+            std::function<void(Ice::OutgoingResponse)>,
+            const Ice::Context&);
+
+        // Sends the queued batches. Called before forwarding a request that isn't batched, to forward the requests
+        // of the session in order. The requests queued meanwhile go to new batches, sent by the next flush.
+        void flush();
+
+        // Sends the queued batches, the requests queued afterwards are forwarded immediately.
+        void destroy();
+
+        void runTimerTask() final;
+
+    private:
+        const std::shared_ptr<Instance> _instance;
+        const std::chrono::milliseconds _flushInterval;
+        const std::int32_t _maxSize;
+
+        // Locked while sending the batches, so that they are sent in order. Locked before _mutex.
+        std::mutex _flushMutex;
+
+        std::mutex _mutex;
+        std::vector<Ice::ObjectPrx> _batchProxies; // The batch oneway proxies with queued requests, in arrival order.
+        std::int32_t _size{0};                     // The size of the queued requests.
+        bool _scheduled{false};
+        bool _destroyed{false};
+    };
+}
+
+#endif
@@ -87,6 +87,7 @@ Glacier2::RouterI::destroy(function<void(exception_ptr)> error)
         }
     }
 
+    _clientBlobject->destroy();
     _routingTable->destroy();
 }
 
@@ -11,13 +11,8 @@ Glacier2::ServerBlobject::ServerBlobject(shared_ptr<Instance> instance, Connecti
 {
 }
 
-void
-Glacier2::ServerBlobject::ice_invokeAsync(
-    pair<const byte*, const byte*> inParams,
-    function<void(bool, pair<const byte*, const byte*>)> response,
-    function<void(exception_ptr)> error,
-    const Current& current)
+ObjectPrx
+Glacier2::ServerBlobject::getTarget(const Current& current)
 {
-    auto proxy = _reverseConnection->createProxy(current.id);
-    invoke(proxy, inParams, std::move(response), std::move(error), current);
+    return _reverseConnection->createProxy(current.id);
 }
@@ -12,11 +12,8 @@ namespace Glacier2
     public:
         ServerBlobject(std::shared_ptr<Instance>, Ice::ConnectionPtr);
 
-        void ice_invokeAsync(
-            std::pair<const std::byte*, const std::byte*> inEncaps,
-            std::function<void(bool, std::pair<const std::byte*, const std::byte*>)> response,
-            std::function<void(std::exception_ptr)> error,
-            const Ice::Current& current) final;
+    protected:
+        Ice::ObjectPrx getTarget(const Ice::Current&) final;
     };
 }
 
@@ -513,9 +513,7 @@ SessionRouterI::SessionRouterI(
       _verifier(std::move(verifier)),
       _sessionManager(std::move(sessionManager)),
       _sslVerifier(std::move(sslVerifier)),
-      _sslSessionManager(std::move(sslSessionManager)),
-      _routersByConnectionHint(_routersByConnection.cend()),
-      _routersByCategoryHint(_routersByCategory.cend())
+      _sslSessionManager(std::move(sslSessionManager))
 {
 }
 
@@ -532,18 +530,15 @@ SessionRouterI::~SessionRouterI()
 void
 SessionRouterI::destroy()
 {
-    map<ConnectionPtr, shared_ptr<RouterI>> routers;
+    vector<shared_ptr<RouterI>> routers;
     {
         lock_guard<mutex> lg(_mutex);
 
         assert(!_destroy);
         _destroy = true;
 
-        _routersByConnection.swap(routers);
-        _routersByConnectionHint = _routersByConnection.cend();
-
+        routers = _routersByConnection.clear();
         _routersByCategory.clear();
-        _routersByCategoryHint = _routersByCategory.cend();
     }
 
     //
@@ -552,7 +547,7 @@ SessionRouterI::destroy()
     //
     for (const auto& router : routers)
     {
-        router.second->destroy([self = shared_from_this()](exception_ptr e) { self->sessionDestroyException(e); });
+        router->destroy([self = shared_from_this()](exception_ptr e) { self->sessionDestroyException(e); });
     }
 }
 
@@ -695,33 +690,17 @@ SessionRouterI::destroySession(const ConnectionPtr& connection)
             throw ObjectNotExistException{__FILE__, __LINE__};
         }
 
-        map<ConnectionPtr, shared_ptr<RouterI>>::const_iterator p;
-
-        if (_routersByConnectionHint != _routersByConnection.cend() && _routersByConnectionHint->first == connection)
-        {
-            p = _routersByConnectionHint;
-        }
-        else
-        {
-            p = _routersByConnection.find(connection);
-        }
-
-        if (p == _routersByConnection.cend())
+        router = _routersByConnection.erase(connection);
+        if (!router)
         {
             throw SessionNotExistException();
         }
 
-        router = p->second;
-
-        _routersByConnection.erase(p++);
-        _routersByConnectionHint = p;
-
         if (_instance->serverObjectAdapter())
         {
             string category = router->getServerProxy(Current())->ice_getIdentity().category;
             assert(!category.empty());
             _routersByCategory.erase(category);
-            _routersByCategoryHint = _routersByCategory.cend();
         }
     }
 
@@ -758,47 +737,33 @@ SessionRouterI::updateSessionObservers()
     const auto& observer = _instance->getObserver();
     assert(observer);
 
-    for (const auto& router : _routersByConnection)
-    {
-        router.second->updateObserver(observer);
-    }
+    _routersByConnection.forEach([&observer](const shared_ptr<RouterI>& router) { router->updateObserver(observer); });
 }
 
 shared_ptr<RouterI>
 SessionRouterI::getRouter(const ConnectionPtr& connection, const Ice::Identity& id, bool close) const
 {
-    lock_guard<mutex> lg(_mutex);
     return getRouterImpl(connection, id, close);
 }
 
 ObjectPtr
 SessionRouterI::getClientBlobject(const ConnectionPtr& connection, const Ice::Identity& id) const
 {
-    lock_guard<mutex> lg(_mutex);
     return getRouterImpl(connection, id, true)->getClientBlobject();
 }
 
 ObjectPtr
 SessionRouterI::getServerBlobject(const string& category) const
 {
-    lock_guard<mutex> lg(_mutex);
-
     if (_destroy)
     {
         throw ObjectNotExistException{__FILE__, __LINE__};
     }
 
-    if (_routersByCategoryHint != _routersByCategory.cend() && _routersByCategoryHint->first == category)
-    {
-        return _routersByCategoryHint->second->getServerBlobject();
-    }
-
-    auto p = _routersByCategory.find(category);
-
-    if (p != _routersByCategory.cend())
+    auto router = _routersByCategory.find(category);
+    if (router)
     {
-        _routersByCategoryHint = p;
-        return p->second->getServerBlobject();
+        return router->getServerBlobject();
     }
     else
     {
@@ -819,17 +784,15 @@ SessionRouterI::getRouterImpl(const ConnectionPtr& connection, const Ice::Identi
         throw ObjectNotExistException{__FILE__, __LINE__};
     }
 
-    if (_routersByConnectionHint != _routersByConnection.cend() && _routersByConnectionHint->first == connection)
+    auto router = _routersByConnection.find(connection);
+    if (router)
     {
-        return _routersByConnectionHint->second;
+        return router;
     }
-
-    auto p = _routersByConnection.find(connection);
-
-    if (p != _routersByConnection.cend())
+    else if (_destroy)
     {
-        _routersByConnectionHint = p;
-        return p->second;
+        // The routers were removed by a concurrent destroy.
+        throw ObjectNotExistException{__FILE__, __LINE__};
     }
     else if (close)
     {
@@ -875,21 +838,9 @@ SessionRouterI::startCreateSession(const shared_ptr<CreateSession>& cb, const Co
     //
     // Check whether a session already exists for the connection.
     //
+    if (_routersByConnection.find(connection))
     {
-        map<ConnectionPtr, shared_ptr<RouterI>>::const_iterator p;
-        if (_routersByConnectionHint != _routersByConnection.cend() && _routersByConnectionHint->first == connection)
-        {
-            p = _routersByConnectionHint;
-        }
-        else
-        {
-            p = _routersByConnection.find(connection);
-        }
-
-        if (p != _routersByConnection.cend())
-        {
-            throw CannotCreateSessionException("session exists");
-        }
+        throw CannotCreateSessionException("session exists");
     }
 
     auto p = _pending.find(connection);
@@ -937,15 +888,14 @@ SessionRouterI::finishCreateSession(const ConnectionPtr& connection, const share
         throw CannotCreateSessionException("router is shutting down");
     }
 
-    _routersByConnectionHint = _routersByConnection.insert(_routersByConnectionHint, {connection, router});
+    _routersByConnection.insert(connection, router);
 
     if (_instance->serverObjectAdapter())
     {
         string category = router->serverProxy()->ice_getIdentity().category;
         assert(!category.empty());
-        auto rc = _routersByCategory.insert({category, router});
-        assert(rc.second);
-        _routersByCategoryHint = rc.first;
+        [[maybe_unused]] bool inserted = _routersByCategory.insert(category, router);
+        assert(inserted);
     }
 
     connection->setCloseCallback(
@@ -8,7 +8,13 @@
 #include "Ice/Ice.h"
 #include "Instrumentation.h"
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <set>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
 
 namespace Glacier2
 {
@@ -54,6 +60,105 @@ namespace Glacier2
         std::shared_ptr<FilterManager> _filterManager;
     };
 
+    //
+    // A map of routers that can be looked up concurrently. The routers are spread over shards, each protected by its
+    // own reader-writer lock, so that looking up the routers of different clients doesn't contend on a single lock.
+    //
+    template<typename Key> class RouterMap
+    {
+    public:
+        [[nodiscard]] std::shared_ptr<RouterI> find(const Key& key) const
+        {
+            const Shard& s = shard(key);
+            std::shared_lock lock(s.mutex);
+            auto p = s.routers.find(key);
+            return p == s.routers.end() ? nullptr : p->second;
+        }
+
+        bool insert(const Key& key, std::shared_ptr<RouterI> router)
+        {
+            Shard& s = shard(key);
+            std::unique_lock lock(s.mutex);
+            return s.routers.emplace(key, std::move(router)).second;
+        }
+
+        // Returns the removed router, or nullptr if there's no router for this key.
+        std::shared_ptr<RouterI> erase(const Key& key)
+        {
+            Shard& s = shard(key);
+            std::unique_lock lock(s.mutex);
+            auto p = s.routers.find(key);
+            if (p == s.routers.end())
+            {
+                return nullptr;
+            }
+            auto router = std::move(p->second);
+            s.routers.erase(p);
+            return router;
+        }
+
+        // Returns the removed routers.
+        std::vector<std::shared_ptr<RouterI>> clear()
+        {
+            std::vector<std::shared_ptr<RouterI>> routers;
+            for (auto& s : _shards)
+            {
+                std::unique_lock lock(s.mutex);
+                for (auto& p : s.routers)
+                {
+                    routers.push_back(std::move(p.second));
+                }
+                s.routers.clear();
+            }
+            return routers;
+        }
+
+        template<typename Func> void forEach(Func func) const
+        {
+            for (const auto& s : _shards)
+            {
+                std::shared_lock lock(s.mutex);
+                for (const auto& p : s.routers)
+                {
+                    func(p.second);
+                }
+            }
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            for (const auto& s : _shards)
+            {
+                std::shared_lock lock(s.mutex);
+                if (!s.routers.empty())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        static constexpr int ShardBits = 6;
+
+        struct alignas(64) Shard
+        {
+            mutable std::shared_mutex mutex;
+            std::unordered_map<Key, std::shared_ptr<RouterI>> routers;
+        };
+
+        const Shard& shard(const Key& key) const
+        {
+            // Fibonacci hashing: the hash of a connection is its address, whose low bits are always the same.
+            auto hash = static_cast<std::uint64_t>(std::hash<Key>{}(key));
+            return _shards[static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15) >> (64 - ShardBits))];
+        }
+
+        Shard& shard(const Key& key) { return const_cast<Shard&>(std::as_const(*this).shard(key)); }
+
+        std::array<Shard, 1 << ShardBits> _shards;
+    };
+
     class SessionRouterI final : public Router,
                                  public Glacier2::Instrumentation::ObserverUpdater,
                                  public std::enable_shared_from_this<SessionRouterI>
@@ -120,15 +225,13 @@ namespace Glacier2
         const std::optional<SSLPermissionsVerifierPrx> _sslVerifier;
         const std::optional<SSLSessionManagerPrx> _sslSessionManager;
 
-        std::map<Ice::ConnectionPtr, std::shared_ptr<RouterI>> _routersByConnection;
-        mutable std::map<Ice::ConnectionPtr, std::shared_ptr<RouterI>>::const_iterator _routersByConnectionHint;
-
-        std::map<std::string, std::shared_ptr<RouterI>> _routersByCategory;
-        mutable std::map<std::string, std::shared_ptr<RouterI>>::const_iterator _routersByCategoryHint;
+        // The router maps are looked up without locking _mutex, they're only updated with _mutex locked.
+        RouterMap<Ice::ConnectionPtr> _routersByConnection;
+        RouterMap<std::string> _routersByCategory;
 
         std::map<Ice::ConnectionPtr, std::shared_ptr<CreateSession>> _pending;
 
-        bool _destroy{false};
+        std::atomic<bool> _destroy{false}; // Only set with _mutex locked.
 
         mutable std::mutex _mutex;
     };
@@ -1,7 +1,9 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Ice/Buffer.h"
+#include "BufferPool.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -53,6 +55,7 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt) noexcept
         _capacity = other._capacity;
         _shrinkCounter = other._shrinkCounter;
         _owned = other._owned;
+        _shared = std::move(other._shared);
 
         other._buf = nullptr;
         other._size = 0;
@@ -67,15 +70,28 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt) noexcept
         _capacity = other._capacity;
         _shrinkCounter = 0;
         _owned = false;
+        _shared = other._shared;
     }
 }
 
+IceInternal::Buffer::Container::Container(shared_ptr<const byte> owner, iterator beg, iterator end) noexcept
+    : _buf(beg),
+      _size(static_cast<size_t>(end - beg)),
+      _capacity(static_cast<size_t>(end - beg)),
+      _shrinkCounter(0),
+      _owned(false),
+      _shared(std::move(owner))
+{
+    assert(_shared);
+}
+
 IceInternal::Buffer::Container::Container(Container&& other) noexcept
     : _buf(other._buf),
       _size(other._size),
       _capacity(other._capacity),
       _shrinkCounter(other._shrinkCounter),
-      _owned(other._owned)
+      _owned(other._owned),
+      _shared(std::move(other._shared))
 {
     // Reset other to default state.
     other._buf = nullptr;
@@ -93,13 +109,14 @@ IceInternal::Buffer::Container::operator=(Container&& other) noexcept
         // If we own the buffer, free it first.
         if (_owned)
         {
-            ::free(_buf);
+            BufferPool::deallocate(_buf, _capacity);
         }
         _buf = other._buf;
         _size = other._size;
         _capacity = other._capacity;
         _shrinkCounter = other._shrinkCounter;
         _owned = other._owned;
+        _shared = std::move(other._shared);
 
         // Reset other to default state.
         other._buf = nullptr;
@@ -115,7 +132,7 @@ IceInternal::Buffer::Container::~Container()
 {
     if (_owned)
     {
-        ::free(_buf);
+        BufferPool::deallocate(_buf, _capacity);
     }
 }
 
@@ -127,6 +144,7 @@ IceInternal::Buffer::Container::swap(Container& other) noexcept
     std::swap(_capacity, other._capacity);
     std::swap(_shrinkCounter, other._shrinkCounter);
     std::swap(_owned, other._owned);
+    _shared.swap(other._shared);
 }
 
 void
@@ -134,7 +152,7 @@ IceInternal::Buffer::Container::clear()
 {
     if (_owned)
     {
-        ::free(_buf);
+        BufferPool::deallocate(_buf, _capacity);
     }
 
     _buf = nullptr;
@@ -142,6 +160,21 @@ IceInternal::Buffer::Container::clear()
     _capacity = 0;
     _shrinkCounter = 0;
     _owned = true;
+    _shared = nullptr;
+}
+
+shared_ptr<const byte>
+IceInternal::Buffer::Container::share()
+{
+    if (!_shared && _owned && _buf)
+    {
+        size_type capacity = _capacity;
+        _shared = shared_ptr<const byte>(
+            _buf,
+            [capacity](const byte* p) { BufferPool::deallocate(const_cast<byte*>(p), capacity); });
+        _owned = false;
+    }
+    return _shared;
 }
 
 void
@@ -157,23 +190,38 @@ IceInternal::Buffer::Container::reserve(size_type n)
     {
         _capacity = n;
     }
-    else
+    else if (!_shared)
+    {
+        return;
+    }
+
+    // Sizes handled by the buffer pool are rounded up to the pool size class.
+    _capacity = BufferPool::capacity(_capacity);
+    if (_capacity == c && _owned)
     {
         return;
     }
 
     pointer p;
-    if (_owned)
+    if (_owned && !BufferPool::pooled(c) && !BufferPool::pooled(_capacity))
     {
         p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
     }
     else
     {
-        p = reinterpret_cast<pointer>(::malloc(_capacity));
+        p = reinterpret_cast<pointer>(BufferPool::allocate(_capacity));
         if (p)
         {
-            ::memcpy(p, _buf, _size);
+            if (_size > 0)
+            {
+                ::memcpy(p, _buf, std::min(_size, _capacity));
+            }
+            if (_owned)
+            {
+                BufferPool::deallocate(_buf, c);
+            }
             _owned = true;
+            _shared = nullptr; // The container no longer refers to the shared memory.
         }
     }
 
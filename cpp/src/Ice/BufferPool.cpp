@@ -0,0 +1,213 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "BufferPool.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <mutex>
+#include <set>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+    const size_t minClassShift = 8;  // 256 bytes
+    const size_t maxClassShift = 16; // 64KB
+    const size_t classCount = maxClassShift - minClassShift + 1;
+
+    // The maximum number of cached blocks for a size class: 16 blocks up to 8KB, then 128KB per size class.
+    const size_t maxCachedBlocks = 16;
+    const size_t maxCachedBytes = 128 * 1024;
+
+    size_t sizeClass(size_t capacity)
+    {
+        size_t n = 0;
+        while ((static_cast<size_t>(1) << (n + minClassShift)) < capacity)
+        {
+            ++n;
+        }
+        return n;
+    }
+
+    size_t classCapacity(size_t n) { return static_cast<size_t>(1) << (n + minClassShift); }
+
+    size_t classLimit(size_t n)
+    {
+        size_t limit = maxCachedBytes / classCapacity(n);
+        return limit < maxCachedBlocks ? limit : maxCachedBlocks;
+    }
+
+    class ThreadCache;
+
+    // The caches of the running threads, and the statistics of the caches of the threads that exited.
+    struct Registry
+    {
+        mutex cachesMutex;
+        set<const ThreadCache*> caches;
+        BufferPool::Stats exited{0, 0, 0, 0};
+    };
+
+    Registry& registry()
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    class ThreadCache
+    {
+    public:
+        ThreadCache();
+        ~ThreadCache();
+
+        void* get(size_t n)
+        {
+            if (_counts[n] > 0)
+            {
+                // Only the owning thread updates the counters, other threads only read them.
+                _hits.store(_hits.load(memory_order_relaxed) + 1, memory_order_relaxed);
+                _cachedBytes.store(_cachedBytes.load(memory_order_relaxed) - classCapacity(n), memory_order_relaxed);
+                return _blocks[n][--_counts[n]];
+            }
+            _misses.store(_misses.load(memory_order_relaxed) + 1, memory_order_relaxed);
+            return nullptr;
+        }
+
+        bool put(size_t n, void* block)
+        {
+            if (_counts[n] < classLimit(n))
+            {
+                _blocks[n][_counts[n]++] = block;
+                _cachedBytes.store(_cachedBytes.load(memory_order_relaxed) + classCapacity(n), memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        [[nodiscard]] BufferPool::Stats stats() const
+        {
+            return {
+                _hits.load(memory_order_relaxed),
+                _misses.load(memory_order_relaxed),
+                1,
+                _cachedBytes.load(memory_order_relaxed)};
+        }
+
+    private:
+        void* _blocks[classCount][maxCachedBlocks]{};
+        size_t _counts[classCount]{};
+        atomic<uint64_t> _hits{0};
+        atomic<uint64_t> _misses{0};
+        atomic<uint64_t> _cachedBytes{0};
+    };
+
+    // Set once the cache of the calling thread is destroyed. Buffers released after this point (for example, by the
+    // destructors of other thread-local or static objects) are freed directly.
+    thread_local bool cacheDestroyed = false;
+
+    ThreadCache* threadCache()
+    {
+        if (cacheDestroyed)
+        {
+            return nullptr;
+        }
+        thread_local ThreadCache cache;
+        return &cache;
+    }
+
+    ThreadCache::ThreadCache()
+    {
+        Registry& r = registry();
+        lock_guard lock(r.cachesMutex);
+        r.caches.insert(this);
+    }
+
+    ThreadCache::~ThreadCache()
+    {
+        cacheDestroyed = true;
+        {
+            Registry& r = registry();
+            lock_guard lock(r.cachesMutex);
+            r.caches.erase(this);
+            r.exited.hits += _hits.load(memory_order_relaxed);
+            r.exited.misses += _misses.load(memory_order_relaxed);
+        }
+        for (size_t n = 0; n < classCount; ++n)
+        {
+            for (size_t i = 0; i < _counts[n]; ++i)
+            {
+                ::free(_blocks[n][i]);
+            }
+        }
+    }
+}
+
+size_t
+IceInternal::BufferPool::capacity(size_t size)
+{
+    return pooled(size) ? classCapacity(sizeClass(size)) : size;
+}
+
+bool
+IceInternal::BufferPool::pooled(size_t capacity)
+{
+    return capacity > 0 && capacity <= classCapacity(classCount - 1);
+}
+
+void*
+IceInternal::BufferPool::allocate(size_t capacity)
+{
+    if (pooled(capacity))
+    {
+        assert(capacity == classCapacity(sizeClass(capacity)));
+        ThreadCache* cache = threadCache();
+        if (cache)
+        {
+            void* block = cache->get(sizeClass(capacity));
+            if (block)
+            {
+                return block;
+            }
+        }
+    }
+    return ::malloc(capacity);
+}
+
+void
+IceInternal::BufferPool::deallocate(void* block, size_t capacity)
+{
+    if (block && pooled(capacity) && capacity == classCapacity(sizeClass(capacity)))
+    {
+        ThreadCache* cache = threadCache();
+        if (cache && cache->put(sizeClass(capacity), block))
+        {
+            return;
+        }
+    }
+    ::free(block);
+}
+
+BufferPool::Stats
+IceInternal::BufferPool::getStats()
+{
+    ThreadCache* cache = threadCache();
+    return cache ? cache->stats() : Stats{0, 0, 0, 0};
+}
+
+BufferPool::Stats
+IceInternal::BufferPool::getProcessStats()
+{
+    Registry& r = registry();
+    lock_guard lock(r.cachesMutex);
+    Stats stats = r.exited;
+    for (const ThreadCache* cache : r.caches)
+    {
+        Stats cacheStats = cache->stats();
+        stats.hits += cacheStats.hits;
+        stats.misses += cacheStats.misses;
+        stats.threads += cacheStats.threads;
+        stats.cachedBytes += cacheStats.cachedBytes;
+    }
+    return stats;
+}
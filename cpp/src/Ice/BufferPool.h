@@ -0,0 +1,51 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace IceInternal
+{
+    //
+    // Size-classed pool for the memory of Buffer::Container. Each thread caches a bounded number of blocks for each
+    // size class (powers of 2 from 256 bytes to 64KB), which avoids calling malloc and free each time a message is
+    // received or marshaled. Blocks are allocated with malloc: a block allocated by a thread can be released by any
+    // thread and the pool never holds more than a few hundred KB per thread.
+    //
+    class BufferPool
+    {
+    public:
+        struct Stats
+        {
+            std::uint64_t hits;        // The allocations served by a thread cache.
+            std::uint64_t misses;      // The allocations of a pooled size served by malloc.
+            std::uint64_t threads;     // The number of threads with a cache.
+            std::uint64_t cachedBytes; // The memory of the blocks held by the caches.
+        };
+
+        // Returns the capacity of the block allocated for the given size: sizes handled by the pool are rounded up to
+        // their size class.
+        static std::size_t capacity(std::size_t);
+
+        // Returns true if blocks of the given capacity are handled by the pool.
+        static bool pooled(std::size_t);
+
+        // Allocates a block of the given capacity, the capacity must be a value returned by capacity(). Returns
+        // nullptr if the allocation fails.
+        static void* allocate(std::size_t);
+
+        // Releases a block allocated with allocate.
+        static void deallocate(void*, std::size_t);
+
+        // Returns the pool statistics of the calling thread.
+        static Stats getStats();
+
+        // Returns the pool statistics of the process: the statistics of the running threads, plus the hits and
+        // misses of the threads that exited.
+        static Stats getProcessStats();
+    };
+}
+
+#endif
@@ -279,6 +279,13 @@ CollocatedRequestHandler::dispatchAll(InputStream& is, int32_t requestId, int32_
     _adapter->decDirectCount();
 }
 
+int32_t
+CollocatedRequestHandler::nextRequestId()
+{
+    lock_guard<mutex> lock(_mutex);
+    return ++_requestId;
+}
+
 void
 CollocatedRequestHandler::handleException(int32_t requestId, std::exception_ptr ex)
 {
@@ -42,6 +42,11 @@ namespace IceInternal
 
         void dispatchAll(Ice::InputStream&, std::int32_t, std::int32_t);
 
+        [[nodiscard]] const std::shared_ptr<Ice::ObjectAdapterI>& adapter() const noexcept { return _adapter; }
+
+        // Returns a new request ID for a twoway request dispatched without this request handler (see DirectDispatch).
+        std::int32_t nextRequestId();
+
     private:
         void handleException(std::int32_t, std::exception_ptr);
 
@@ -0,0 +1,276 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "CompressionCodec.h"
+#include "Ice/LocalExceptions.h"
+
+#if defined(ICE_HAS_BZIP2)
+#    include <bzlib.h>
+#endif
+
+#if defined(ICE_HAS_ZSTD)
+#    include <zstd.h>
+#endif
+
+#if defined(ICE_HAS_LZ4)
+#    include <lz4.h>
+#endif
+
+#include <limits>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+#if defined(ICE_HAS_BZIP2)
+    string getBZ2Error(int bzError)
+    {
+        switch (bzError)
+        {
+            case BZ_RUN_OK:
+                return ": BZ_RUN_OK";
+            case BZ_FLUSH_OK:
+                return ": BZ_FLUSH_OK";
+            case BZ_FINISH_OK:
+                return ": BZ_FINISH_OK";
+            case BZ_STREAM_END:
+                return ": BZ_STREAM_END";
+            case BZ_CONFIG_ERROR:
+                return ": BZ_CONFIG_ERROR";
+            case BZ_SEQUENCE_ERROR:
+                return ": BZ_SEQUENCE_ERROR";
+            case BZ_PARAM_ERROR:
+                return ": BZ_PARAM_ERROR";
+            case BZ_MEM_ERROR:
+                return ": BZ_MEM_ERROR";
+            case BZ_DATA_ERROR:
+                return ": BZ_DATA_ERROR";
+            case BZ_DATA_ERROR_MAGIC:
+                return ": BZ_DATA_ERROR_MAGIC";
+            case BZ_IO_ERROR:
+                return ": BZ_IO_ERROR";
+            case BZ_UNEXPECTED_EOF:
+                return ": BZ_UNEXPECTED_EOF";
+            case BZ_OUTBUFF_FULL:
+                return ": BZ_OUTBUFF_FULL";
+            default:
+                return "";
+        }
+    }
+
+    class Bzip2Codec final : public CompressionCodec
+    {
+    public:
+        [[nodiscard]] uint8_t compressionStatus() const final { return 2; }
+
+        [[nodiscard]] string name() const final { return "bzip2"; }
+
+        [[nodiscard]] size_t maxCompressedSize(size_t size) const final
+        {
+            return static_cast<size_t>(static_cast<double>(size) * 1.01 + 600);
+        }
+
+        size_t compress(const byte* src, size_t srcSize, byte* dst, size_t dstSize, int level) const final
+        {
+            // The level is the bzip2 block size (in units of 100KB).
+            auto compressedLen = static_cast<unsigned int>(dstSize);
+            int bzError = BZ2_bzBuffToBuffCompress(
+                reinterpret_cast<char*>(dst),
+                &compressedLen,
+                const_cast<char*>(reinterpret_cast<const char*>(src)),
+                static_cast<unsigned int>(srcSize),
+                level,
+                0,
+                0);
+            if (bzError != BZ_OK)
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot compress message - BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError)};
+            }
+            return compressedLen;
+        }
+
+        void uncompress(const byte* src, size_t srcSize, byte* dst, size_t dstSize) const final
+        {
+            auto uncompressedLen = static_cast<unsigned int>(dstSize);
+            int bzError = BZ2_bzBuffToBuffDecompress(
+                reinterpret_cast<char*>(dst),
+                &uncompressedLen,
+                const_cast<char*>(reinterpret_cast<const char*>(src)),
+                static_cast<unsigned int>(srcSize),
+                0,
+                0);
+            if (bzError != BZ_OK)
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot decompress message - BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError)};
+            }
+        }
+    };
+#endif
+
+#if defined(ICE_HAS_ZSTD)
+    class ZstdCodec final : public CompressionCodec
+    {
+    public:
+        [[nodiscard]] uint8_t compressionStatus() const final { return 3; }
+
+        [[nodiscard]] string name() const final { return "zstd"; }
+
+        [[nodiscard]] size_t maxCompressedSize(size_t size) const final { return ZSTD_compressBound(size); }
+
+        size_t compress(const byte* src, size_t srcSize, byte* dst, size_t dstSize, int level) const final
+        {
+            // Levels 1 to 9 are used as is, they are the fast zstd levels.
+            size_t rs = ZSTD_compress(dst, dstSize, src, srcSize, level);
+            if (ZSTD_isError(rs))
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    string{"cannot compress message - ZSTD_compress failed: "} + ZSTD_getErrorName(rs)};
+            }
+            return rs;
+        }
+
+        void uncompress(const byte* src, size_t srcSize, byte* dst, size_t dstSize) const final
+        {
+            size_t rs = ZSTD_decompress(dst, dstSize, src, srcSize);
+            if (ZSTD_isError(rs))
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    string{"cannot decompress message - ZSTD_decompress failed: "} + ZSTD_getErrorName(rs)};
+            }
+            else if (rs != dstSize)
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot decompress message - unexpected uncompressed size " + to_string(rs)};
+            }
+        }
+    };
+#endif
+
+#if defined(ICE_HAS_LZ4)
+    class Lz4Codec final : public CompressionCodec
+    {
+    public:
+        [[nodiscard]] uint8_t compressionStatus() const final { return 4; }
+
+        [[nodiscard]] string name() const final { return "lz4"; }
+
+        [[nodiscard]] size_t maxCompressedSize(size_t size) const final
+        {
+            return static_cast<size_t>(LZ4_compressBound(static_cast<int>(size)));
+        }
+
+        size_t compress(const byte* src, size_t srcSize, byte* dst, size_t dstSize, int level) const final
+        {
+            // Level 9 uses the default LZ4 acceleration (best compression ratio), lower levels trade compression
+            // ratio for speed.
+            int rs = LZ4_compress_fast(
+                reinterpret_cast<const char*>(src),
+                reinterpret_cast<char*>(dst),
+                static_cast<int>(srcSize),
+                static_cast<int>(min(dstSize, static_cast<size_t>(numeric_limits<int>::max()))),
+                10 - level);
+            if (rs <= 0)
+            {
+                throw ProtocolException{__FILE__, __LINE__, "cannot compress message - LZ4_compress_fast failed"};
+            }
+            return static_cast<size_t>(rs);
+        }
+
+        void uncompress(const byte* src, size_t srcSize, byte* dst, size_t dstSize) const final
+        {
+            int rs = LZ4_decompress_safe(
+                reinterpret_cast<const char*>(src),
+                reinterpret_cast<char*>(dst),
+                static_cast<int>(srcSize),
+                static_cast<int>(dstSize));
+            if (rs < 0 || static_cast<size_t>(rs) != dstSize)
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot decompress message - LZ4_decompress_safe failed"};
+            }
+        }
+    };
+#endif
+
+#if defined(ICE_HAS_BZIP2)
+    const Bzip2Codec bzip2Codec;
+#endif
+#if defined(ICE_HAS_ZSTD)
+    const ZstdCodec zstdCodec;
+#endif
+#if defined(ICE_HAS_LZ4)
+    const Lz4Codec lz4Codec;
+#endif
+
+    const CompressionCodec* const codecs[] = {
+#if defined(ICE_HAS_BZIP2)
+        &bzip2Codec,
+#endif
+#if defined(ICE_HAS_ZSTD)
+        &zstdCodec,
+#endif
+#if defined(ICE_HAS_LZ4)
+        &lz4Codec,
+#endif
+    };
+}
+
+IceInternal::CompressionCodec::~CompressionCodec() = default;
+
+const CompressionCodec*
+IceInternal::findCompressionCodec(uint8_t compressionStatus)
+{
+    for (const CompressionCodec* codec : codecs)
+    {
+        if (codec->compressionStatus() == compressionStatus)
+        {
+            return codec;
+        }
+    }
+    return nullptr;
+}
+
+const CompressionCodec*
+IceInternal::findCompressionCodec(string_view name)
+{
+    for (const CompressionCodec* codec : codecs)
+    {
+        if (codec->name() == name)
+        {
+            return codec;
+        }
+    }
+    return nullptr;
+}
+
+uint8_t
+IceInternal::compressionCodecBit(const CompressionCodec& codec)
+{
+    return codec.compressionStatus() > 2 ? static_cast<uint8_t>(1 << (codec.compressionStatus() - 3)) : 0;
+}
+
+uint8_t
+IceInternal::compressionCodecMask()
+{
+    uint8_t mask = 0;
+    for (const CompressionCodec* codec : codecs)
+    {
+        mask |= compressionCodecBit(*codec);
+    }
+    return mask;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_COMPRESSION_CODEC_H
+#define ICE_COMPRESSION_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#ifndef ICE_HAS_BZIP2
+#    define ICE_HAS_BZIP2
+#endif
+
+namespace IceInternal
+{
+    //
+    // A codec compresses the body of Ice protocol messages. The codec of a compressed message is identified by the
+    // compression status byte of the message header: 2 for bzip2 (the only codec supported by Ice 3.7 and earlier
+    // releases), 3 for zstd and 4 for lz4. The zstd and lz4 codecs are only available if Ice is built with
+    // ICE_HAS_ZSTD and ICE_HAS_LZ4.
+    //
+    // The codec is negotiated per connection: the server side advertises the codecs it supports other than bzip2
+    // in the compression status byte of its ValidateConnection message (see compressionCodecMask), and the client
+    // side only uses the codec configured with Ice.Compression.Codec if the server supports it. Otherwise, and with
+    // peers that don't advertise any codec (such as Ice 3.7), the connection falls back to bzip2.
+    //
+    class CompressionCodec
+    {
+    public:
+        virtual ~CompressionCodec();
+
+        // The compression status of messages compressed with this codec.
+        [[nodiscard]] virtual std::uint8_t compressionStatus() const = 0;
+
+        // The name of the codec, as specified with the Ice.Compression.Codec property.
+        [[nodiscard]] virtual std::string name() const = 0;
+
+        // Returns the maximum size of the compressed data for the given number of bytes.
+        [[nodiscard]] virtual std::size_t maxCompressedSize(std::size_t) const = 0;
+
+        // Compresses the source bytes into the destination buffer and returns the size of the compressed data. The
+        // level is the value of the Ice.Compression.Level property (1 to 9), each codec maps it to its own levels.
+        // Throws ProtocolException on failure.
+        virtual std::size_t compress(const std::byte*, std::size_t, std::byte*, std::size_t, int) const = 0;
+
+        // Uncompresses the source bytes into the destination buffer, which must be exactly the size of the
+        // uncompressed data. Throws ProtocolException on failure.
+        virtual void uncompress(const std::byte*, std::size_t, std::byte*, std::size_t) const = 0;
+    };
+
+    // Returns the codec for the given compression status or nullptr if there's no such codec.
+    const CompressionCodec* findCompressionCodec(std::uint8_t);
+
+    // Returns the codec with the given name or nullptr if there's no such codec.
+    const CompressionCodec* findCompressionCodec(std::string_view);
+
+    // Returns the bit of the codec in the compression codec mask. The codec with compression status N (N >= 3) is
+    // represented by the bit N - 3; bzip2 is always supported and has no bit.
+    std::uint8_t compressionCodecBit(const CompressionCodec&);
+
+    // Returns the mask of the codecs supported by this build other than bzip2, as sent by the server side in the
+    // compression status byte of the ValidateConnection message.
+    std::uint8_t compressionCodecMask();
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include "ConnectionI.h"
 #include "BatchRequestQueue.h"
 #include "CheckIdentity.h"
+#include "CompressionCodec.h"
 #include "Endian.h"
 #include "EndpointI.h"
 #include "Ice/IncomingRequest.h"
@@ -26,10 +27,6 @@
 #include <iomanip>
 #include <stdexcept>
 
-#ifdef ICE_HAS_BZIP2
-#    include <bzlib.h>
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -104,6 +101,11 @@ namespace
         const Ice::ConnectionIPtr _connection;
     };
 
+#if !defined(ICE_USE_IOCP)
+    // The maximum number of queued messages sent with a single gather write.
+    const size_t maxGatherWriteMessages = 64;
+#endif
+
     ConnectionState connectionStateMap[] = {
         ConnectionState::ConnectionStateValidating, // StateNotInitialized
         ConnectionState::ConnectionStateValidating, // StateNotValidated
@@ -292,7 +294,7 @@ Ice::ConnectionI::OutgoingMessage::adopt(OutputStream* str)
     }
 
     assert(str);
-    assert(str->b.ownsMemory());
+    assert(str->b.ownsMemory() || str->b.sharesMemory());
     stream = new OutputStream(std::move(*str));
     adopted = true;
 }
@@ -859,9 +861,10 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, exc
             {
                 //
                 // If the request is being sent, don't remove it from the send streams,
-                // it will be removed once the sending is finished.
+                // it will be removed once the sending is finished. This is also the case for a queued
+                // request partially or fully written by a gather write (see writeMessages).
                 //
-                if (o == _sendStreams.begin())
+                if (o == _sendStreams.begin() || o->stream->i)
                 {
                     o->canceled(true); // true = adopt the stream
                 }
@@ -1911,6 +1914,7 @@ Ice::ConnectionI::ConnectionI(
       _removeFromFactory(std::move(removeFromFactory)),
       _warn(_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Connections") > 0),
       _warnUdp(_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Datagrams") > 0),
+      _compressionCodec(findCompressionCodec("bzip2")),
       _asyncRequestsHint(_asyncRequests.end()),
       _messageSizeMax(connector ? _instance->messageSizeMax() : adapter->messageSizeMax()),
       _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
@@ -1971,13 +1975,13 @@ Ice::ConnectionI::create(
 
     if (connector) // client connection
     {
-        const_cast<ThreadPoolPtr&>(connection->_threadPool) = connection->_instance->clientThreadPool();
+        const_cast<ThreadPoolPtr&>(connection->_threadPool) = connection->_instance->clientThreadPool()->getShard();
     }
     else
     {
         // server connection
         assert(adapter);
-        const_cast<ThreadPoolPtr&>(connection->_threadPool) = adapter->getThreadPool();
+        const_cast<ThreadPoolPtr&>(connection->_threadPool) = adapter->getThreadPool()->getShard();
     }
     connection->_threadPool->initialize(connection);
     return connection;
@@ -2496,6 +2500,13 @@ Ice::ConnectionI::sendResponse(OutgoingResponse response, uint8_t compress)
             if (isTwoWay)
             {
                 OutgoingMessage message(&response.outputStream(), compress > 0);
+                if (compress > 0)
+                {
+                    // Compress the reply with the codec of the request or, if the request isn't compressed, with
+                    // the codec of the connection.
+                    message.codec = compress > 1 ? findCompressionCodec(compress) : _compressionCodec;
+                    assert(message.codec);
+                }
                 sendMessage(message);
             }
 
@@ -2560,9 +2571,13 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(
-                    static_cast<uint8_t>(0));   // Compression status (always zero for validate connection).
-                _writeStream.write(headerSize); // Message size.
+#ifdef ICE_HAS_BZIP2
+                // The compression status advertises the codecs supported by the server other than bzip2.
+                _writeStream.write(compressionCodecMask());
+#else
+                _writeStream.write(static_cast<uint8_t>(0)); // Compression status.
+#endif
+                _writeStream.write(headerSize);              // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _instance, this, _logger, _traceLevels);
             }
@@ -2654,7 +2669,7 @@ Ice::ConnectionI::validate(SocketOperation operation)
                         " over a connection that is not yet validated"};
             }
             uint8_t compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
+            _readStream.read(compress); // The codecs supported by the server other than bzip2.
             int32_t size;
             _readStream.read(size);
             if (size != headerSize)
@@ -2666,6 +2681,15 @@ Ice::ConnectionI::validate(SocketOperation operation)
             }
             traceRecv(_readStream, this, _logger, _traceLevels);
 
+#ifdef ICE_HAS_BZIP2
+            // Use the configured codec if the server supports it, otherwise keep bzip2.
+            const CompressionCodec* codec = _instance->compressionCodec();
+            if ((compress & compressionCodecBit(*codec)) != 0)
+            {
+                _compressionCodec = codec;
+            }
+#endif
+
             // Client connection starts sending heartbeats once it has received the ValidateConnection message.
             if (_idleTimeoutTransceiver)
             {
@@ -2721,6 +2745,7 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
 
     try
     {
+        SocketOperation op = SocketOperationNone;
         while (true)
         {
             //
@@ -2760,29 +2785,38 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
             // Otherwise, prepare the next message.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
+            if (message->stream->i)
+            {
+                //
+                // The message size was already filled in by writeMessages, which might also have sent some or
+                // all of the message.
+                //
+                traceSend(*message->stream, _instance, this, _logger, _traceLevels);
+            }
 #ifdef ICE_HAS_BZIP2
-            if (message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
+            else if (message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
             {
+                const CompressionCodec& codec = message->codec ? *message->codec : *_compressionCodec;
+
                 //
                 // Message compressed. Request compressed response, if any.
                 //
-                message->stream->b[9] = byte{2};
+                message->stream->b[9] = byte{codec.compressionStatus()};
 
                 //
                 // Do compression.
                 //
                 OutputStream stream{currentProtocolEncoding};
-                doCompress(*message->stream, stream);
+                doCompress(*message->stream, stream, codec);
 
                 traceSend(*message->stream, _instance, this, _logger, _traceLevels);
 
                 message->adopt(&stream); // Adopt the compressed stream.
                 message->stream->i = message->stream->b.begin();
             }
+#endif
             else
             {
-#endif
                 if (message->compress)
                 {
                     //
@@ -2806,13 +2840,10 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
                 }
                 message->stream->i = message->stream->b.begin();
                 traceSend(*message->stream, _instance, this, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
             }
-#endif
 
             //
-            // Send the message.
+            // Send the message, the messages queued after it are sent with the same write if possible.
             //
             _writeStream.swap(*message->stream);
             if (_observer)
@@ -2822,8 +2853,14 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
             assert(_writeStream.i);
             if (_writeStream.i != _writeStream.b.end())
             {
-                SocketOperation op = write(_writeStream);
                 if (op)
+                {
+                    // The previous write already failed to send the remainder of this message.
+                    return op;
+                }
+
+                op = writeMessages();
+                if (op && _writeStream.i != _writeStream.b.end())
                 {
                     return op;
                 }
@@ -2840,7 +2877,7 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
         if (_state == StateClosing && _shutdownInitiated)
         {
             setState(StateClosingPending);
-            SocketOperation op = _transceiver->closing(true, _exception);
+            op = _transceiver->closing(true, _exception);
             if (op)
             {
                 return op;
@@ -2854,6 +2891,82 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
     return SocketOperationNone;
 }
 
+SocketOperation
+Ice::ConnectionI::writeMessages()
+{
+    assert(!_sendStreams.empty() && _writeStream.i != _writeStream.b.end());
+
+#if defined(ICE_USE_IOCP)
+    return write(_writeStream);
+#else
+    //
+    // Fill in the size of the uncompressed messages queued after the message being sent and write them all with a
+    // single gather write. Compressed messages are only compressed when they are about to be sent.
+    //
+    _writeBuffers.clear();
+    _writeBuffers.push_back(&_writeStream);
+    for (auto p = _sendStreams.begin() + 1; p != _sendStreams.end() && _writeBuffers.size() < maxGatherWriteMessages;
+         ++p)
+    {
+        OutputStream* stream = p->stream;
+        assert(!stream->i);
+#    ifdef ICE_HAS_BZIP2
+        if (p->compress && stream->b.size() >= 100)
+        {
+            break;
+        }
+#    endif
+        if (p->compress)
+        {
+            stream->b[9] = byte{1};
+        }
+
+        auto sz = static_cast<int32_t>(stream->b.size());
+        const byte* q = reinterpret_cast<const byte*>(&sz);
+        if constexpr (endian::native == endian::big)
+        {
+            reverse_copy(q, q + sizeof(int32_t), stream->b.begin() + 10);
+        }
+        else
+        {
+            copy(q, q + sizeof(int32_t), stream->b.begin() + 10);
+        }
+        stream->i = stream->b.begin();
+        _writeBuffers.push_back(stream);
+    }
+
+    if (_writeBuffers.size() == 1)
+    {
+        return write(_writeStream);
+    }
+
+    SocketOperation op = write(_writeBuffers);
+
+    //
+    // The queued messages which were not written at all are reset: they can still be canceled and removed from the
+    // send queue. The bytes written for the other messages are reported to the observer here, the observer only
+    // tracks the message being sent.
+    //
+    int sent = 0;
+    for (auto p = _writeBuffers.begin() + 1; p != _writeBuffers.end(); ++p)
+    {
+        if ((*p)->i == (*p)->b.begin())
+        {
+            (*p)->i = nullptr;
+        }
+        else
+        {
+            sent += static_cast<int>((*p)->i - (*p)->b.begin());
+        }
+    }
+    if (sent > 0 && _observer)
+    {
+        _observer->sentBytes(sent);
+    }
+    return op;
+#endif
+}
+
 AsyncStatus
 Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 {
@@ -2877,16 +2990,18 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 #ifdef ICE_HAS_BZIP2
     if (message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
     {
+        const CompressionCodec& codec = message.codec ? *message.codec : *_compressionCodec;
+
         //
         // Message compressed. Request compressed response, if any.
         //
-        message.stream->b[9] = byte{2};
+        message.stream->b[9] = byte{codec.compressionStatus()};
 
         //
         // Do compression.
         //
         OutputStream stream{currentProtocolEncoding};
-        doCompress(*message.stream, stream);
+        doCompress(*message.stream, stream, codec);
         stream.i = stream.b.begin();
 
         traceSend(*message.stream, _instance, this, _logger, _traceLevels);
@@ -2978,93 +3093,22 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 }
 
 #ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
-{
-    if (bzError == BZ_RUN_OK)
-    {
-        return ": BZ_RUN_OK";
-    }
-    else if (bzError == BZ_FLUSH_OK)
-    {
-        return ": BZ_FLUSH_OK";
-    }
-    else if (bzError == BZ_FINISH_OK)
-    {
-        return ": BZ_FINISH_OK";
-    }
-    else if (bzError == BZ_STREAM_END)
-    {
-        return ": BZ_STREAM_END";
-    }
-    else if (bzError == BZ_CONFIG_ERROR)
-    {
-        return ": BZ_CONFIG_ERROR";
-    }
-    else if (bzError == BZ_SEQUENCE_ERROR)
-    {
-        return ": BZ_SEQUENCE_ERROR";
-    }
-    else if (bzError == BZ_PARAM_ERROR)
-    {
-        return ": BZ_PARAM_ERROR";
-    }
-    else if (bzError == BZ_MEM_ERROR)
-    {
-        return ": BZ_MEM_ERROR";
-    }
-    else if (bzError == BZ_DATA_ERROR)
-    {
-        return ": BZ_DATA_ERROR";
-    }
-    else if (bzError == BZ_DATA_ERROR_MAGIC)
-    {
-        return ": BZ_DATA_ERROR_MAGIC";
-    }
-    else if (bzError == BZ_IO_ERROR)
-    {
-        return ": BZ_IO_ERROR";
-    }
-    else if (bzError == BZ_UNEXPECTED_EOF)
-    {
-        return ": BZ_UNEXPECTED_EOF";
-    }
-    else if (bzError == BZ_OUTBUFF_FULL)
-    {
-        return ": BZ_OUTBUFF_FULL";
-    }
-    else
-    {
-        return "";
-    }
-}
-
 void
-Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compressed)
+Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compressed, const CompressionCodec& codec)
 {
     const byte* p;
 
     //
     // Compress the message body, but not the header.
     //
-    auto uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    auto compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
-    compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(
-        reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-        &compressedLen,
-        reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    compressed.b.resize(headerSize + sizeof(int32_t) + codec.maxCompressedSize(uncompressedLen));
+    size_t compressedLen = codec.compress(
+        &uncompressed.b[0] + headerSize,
         uncompressedLen,
-        _compressionLevel,
-        0,
-        0);
-    if (bzError != BZ_OK)
-    {
-        throw ProtocolException{
-            __FILE__,
-            __LINE__,
-            "cannot compress message - BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError)};
-    }
+        &compressed.b[0] + headerSize + sizeof(int32_t),
+        compressed.b.size() - headerSize - sizeof(int32_t),
+        _compressionLevel);
     compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
 
     //
@@ -3105,7 +3149,7 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
 }
 
 void
-Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed)
+Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed, const CompressionCodec& codec)
 {
     int32_t uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
@@ -3124,22 +3168,11 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     }
     uncompressed.resize(static_cast<size_t>(uncompressedSize));
 
-    auto uncompressedLen = static_cast<unsigned int>(uncompressedSize - headerSize);
-    auto compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(int32_t));
-    int bzError = BZ2_bzBuffToBuffDecompress(
-        reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-        &uncompressedLen,
-        reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-        compressedLen,
-        0,
-        0);
-    if (bzError != BZ_OK)
-    {
-        throw ProtocolException{
-            __FILE__,
-            __LINE__,
-            "cannot decompress message - BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError)};
-    }
+    codec.uncompress(
+        &compressed.b[0] + headerSize + sizeof(int32_t),
+        compressed.b.size() - headerSize - sizeof(int32_t),
+        &uncompressed.b[0] + headerSize,
+        static_cast<size_t>(uncompressedSize - headerSize));
 
     copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
 }
@@ -3171,11 +3204,21 @@ Ice::ConnectionI::parseMessage(int32_t& upcallCount, function<bool(InputStream&)
         uint8_t compress;
         stream.read(compress);
 
-        if (compress == 2)
+        if (compress > 1)
         {
 #ifdef ICE_HAS_BZIP2
+            const CompressionCodec* codec = findCompressionCodec(compress);
+            if (!codec)
+            {
+                throw FeatureNotSupportedException(
+                    __FILE__,
+                    __LINE__,
+                    "cannot uncompress message with compression status " + to_string(static_cast<int>(compress)));
+            }
+            _compressionCodec = codec;
+
             InputStream ustream{_instance.get(), currentProtocolEncoding};
-            doUncompress(stream, ustream);
+            doUncompress(stream, ustream, *codec);
             stream.b.swap(ustream.b);
 #else
             throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
@@ -3532,6 +3575,38 @@ ConnectionI::write(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::write(const vector<Buffer*>& buffers)
+{
+    if (_instance->traceLevels()->network < 3)
+    {
+        return _transceiver->gatherWrite(buffers);
+    }
+
+    size_t size = 0;
+    for (Buffer* buf : buffers)
+    {
+        size += static_cast<size_t>(buf->b.end() - buf->i);
+    }
+
+    SocketOperation op = _transceiver->gatherWrite(buffers);
+
+    size_t remaining = 0;
+    for (Buffer* buf : buffers)
+    {
+        remaining += static_cast<size_t>(buf->b.end() - buf->i);
+    }
+
+    if (remaining != size)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "sent " << (size - remaining) << " of " << size << " bytes in " << buffers.size()
+            << " messages via " << _endpoint->protocol() << "\n"
+            << toString();
+    }
+    return op;
+}
+
 void
 ConnectionI::scheduleInactivityTimerTask()
 {
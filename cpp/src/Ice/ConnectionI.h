@@ -3,6 +3,7 @@
 #ifndef ICE_CONNECTION_I_H
 #define ICE_CONNECTION_I_H
 
+#include "CompressionCodec.h"
 #include "ConnectionFactoryF.h"
 #include "ConnectionOptions.h"
 #include "ConnectorF.h"
@@ -31,10 +32,6 @@
 #include <list>
 #include <mutex>
 
-#ifndef ICE_HAS_BZIP2
-#    define ICE_HAS_BZIP2
-#endif
-
 namespace IceInternal
 {
     class IdleTimeoutTransceiverDecorator;
@@ -90,9 +87,9 @@ namespace Ice
 #endif
             {
                 assert(stream);
-                // The outgoing message can be sent asynchronously. If the stream doesn't own its memory, the memory
-                // owner could release it before the message is sent.
-                assert(stream->b.ownsMemory());
+                // The outgoing message can be sent asynchronously. If the stream doesn't own or share its memory, the
+                // memory owner could release it before the message is sent.
+                assert(stream->b.ownsMemory() || stream->b.sharesMemory());
             }
 
             OutgoingMessage(IceInternal::OutgoingAsyncBasePtr o, Ice::OutputStream* str, bool comp, int rid)
@@ -109,7 +106,7 @@ namespace Ice
 #endif
             {
                 assert(stream);
-                assert(stream->b.ownsMemory());
+                assert(stream->b.ownsMemory() || stream->b.sharesMemory());
             }
 
             void adopt(Ice::OutputStream*);
@@ -120,6 +117,8 @@ namespace Ice
             Ice::OutputStream* stream;
             IceInternal::OutgoingAsyncBasePtr outAsync;
             bool compress;
+            // The codec used to compress the message, if null the connection codec is used.
+            const IceInternal::CompressionCodec* codec{nullptr};
             int requestId;
             bool adopted;
 #if defined(ICE_USE_IOCP)
@@ -301,9 +300,16 @@ namespace Ice
         /// @return The send status.
         IceInternal::AsyncStatus sendMessage(OutgoingMessage& message);
 
+        /// Writes the message being sent (_writeStream) together with the uncompressed messages queued after it,
+        /// using a single gather write. The queued messages which are not written at all are left untouched.
+        ///
+        /// @return The socket operation to register with the thread pool's selector if the message being sent or one
+        /// of the queued messages was not fully written.
+        IceInternal::SocketOperation writeMessages();
+
 #ifdef ICE_HAS_BZIP2
-        void doCompress(Ice::OutputStream&, Ice::OutputStream&);
-        void doUncompress(Ice::InputStream&, Ice::InputStream&);
+        void doCompress(Ice::OutputStream&, Ice::OutputStream&, const IceInternal::CompressionCodec&);
+        void doUncompress(Ice::InputStream&, Ice::InputStream&, const IceInternal::CompressionCodec&);
 #endif
 
         IceInternal::SocketOperation parseMessage(
@@ -318,6 +324,7 @@ namespace Ice
 
         IceInternal::SocketOperation read(IceInternal::Buffer&);
         IceInternal::SocketOperation write(IceInternal::Buffer&);
+        IceInternal::SocketOperation write(const std::vector<IceInternal::Buffer*>&);
 
         void scheduleInactivityTimerTask();
         void cancelInactivityTimerTask();
@@ -365,6 +372,12 @@ namespace Ice
 
         const int _compressionLevel{1};
 
+        // The codec used to compress the messages sent over this connection, bzip2 unless another codec is
+        // negotiated. For a client connection, it's the codec configured with Ice.Compression.Codec if the server
+        // advertised it in its ValidateConnection message. For a server connection, it's the codec of the last
+        // compressed message received from the client.
+        const IceInternal::CompressionCodec* _compressionCodec;
+
         std::int32_t _nextRequestId{1};
 
         std::map<std::int32_t, IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
@@ -389,6 +402,11 @@ namespace Ice
         // Contains the message which is being sent. The write stream buffer is empty if no message is being sent.
         Ice::OutputStream _writeStream;
 
+#if !defined(ICE_USE_IOCP)
+        // The buffers written with a single gather write by writeMessages.
+        std::vector<IceInternal::Buffer*> _writeBuffers;
+#endif
+
         Observer _observer;
 
         // The upcall count keeps track of the number of dispatches, AMI (response) continuations, sent callbacks and
@@ -0,0 +1,153 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/DirectDispatch.h"
+#include "CollocatedRequestHandler.h"
+#include "Ice/ImplicitContext.h"
+#include "Ice/InputStream.h"
+#include "Ice/LocalExceptions.h"
+#include "Ice/OutgoingResponse.h"
+#include "Instance.h"
+#include "LoggerMiddleware.h"
+#include "ObjectAdapterI.h"
+#include "Protocol.h"
+#include "Reference.h"
+#include "RequestHandlerCache.h"
+#include "ServantManager.h"
+#include "TraceLevels.h"
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceInternal::DirectDispatch::DirectDispatch(
+    const ObjectPrx& proxy,
+    string_view operation,
+    OperationMode mode,
+    const Context& context)
+{
+    const ReferencePtr& ref = proxy._getReference();
+    if (!ref->isTwoway() || !ref->getCollocationOptimized() || !ref->getCacheConnection() ||
+        ref->getInvocationTimeout() > 0ms)
+    {
+        return;
+    }
+
+    const InstancePtr& instance = ref->getInstance();
+    if (instance->initializationData().executor || instance->initializationData().observer ||
+        instance->traceLevels()->protocol >= 1)
+    {
+        return;
+    }
+
+    // We only use the request handler cached by a previous invocation: the first invocation is never direct.
+    auto handler =
+        dynamic_pointer_cast<CollocatedRequestHandler>(proxy._getRequestHandlerCache()->getCachedRequestHandler());
+    if (!handler)
+    {
+        return;
+    }
+
+    // The only middleware we support is the logger middleware installed by Ice.Warn.Dispatch (enabled by default),
+    // when it doesn't trace the dispatches: it only logs the exceptions thrown by the servant.
+    const shared_ptr<ObjectAdapterI>& adapter = handler->adapter();
+    const ObjectPtr& dispatchPipeline = adapter->dispatchPipeline();
+    if (dispatchPipeline != adapter->getServantManager())
+    {
+        auto loggerMiddleware = dynamic_pointer_cast<LoggerMiddleware>(dispatchPipeline);
+        if (!loggerMiddleware || loggerMiddleware->tracesDispatches() ||
+            loggerMiddleware->next() != adapter->getServantManager())
+        {
+            return;
+        }
+        _loggerMiddleware = std::move(loggerMiddleware);
+    }
+
+    // Prevents the object adapter from being destroyed during the call.
+    try
+    {
+        adapter->incDirectCount();
+    }
+    catch (const ObjectAdapterDestroyedException&)
+    {
+        return; // The regular invocation handles the destruction of the object adapter.
+    }
+    _adapter = adapter;
+
+    _servant = adapter->getServantManager()->findServant(ref->getIdentity(), ref->getFacet());
+    if (!_servant)
+    {
+        return; // The servant may be provided by a servant locator, or there's no servant.
+    }
+
+    _instance = instance;
+    _current.adapter = adapter;
+    _current.id = ref->getIdentity();
+    _current.facet = ref->getFacet();
+    _current.operation = operation;
+    _current.mode = mode;
+    if (&context != &noExplicitContext)
+    {
+        _current.ctx = context;
+    }
+    else
+    {
+        const ImplicitContextPtr& implicitContext = instance->getImplicitContext();
+        const Context& prxContext = ref->getContext()->getValue();
+        if (implicitContext)
+        {
+            implicitContext->combine(prxContext, _current.ctx);
+        }
+        else
+        {
+            _current.ctx = prxContext;
+        }
+    }
+    _current.requestId = handler->nextRequestId();
+    _current.encoding = ref->getEncoding();
+}
+
+IceInternal::DirectDispatch::~DirectDispatch()
+{
+    if (_adapter)
+    {
+        _adapter->decDirectCount();
+    }
+}
+
+void
+IceInternal::DirectDispatch::rethrow(
+    exception_ptr exception,
+    const function<void(const UserException&)>& userException) const
+{
+    if (_loggerMiddleware)
+    {
+        _loggerMiddleware->logException(exception, _current);
+    }
+
+    try
+    {
+        rethrow_exception(exception);
+    }
+    catch (const UserException& ex)
+    {
+        if (userException)
+        {
+            userException(ex);
+        }
+        throw UnknownUserException::fromTypeId(__FILE__, __LINE__, ex.ice_id());
+    }
+    catch (...)
+    {
+    }
+
+    // The other exceptions are marshaled into a response by the dispatch, and unmarshaled from this response by the
+    // invocation: for example, a local exception is received as an UnknownLocalException.
+    OutgoingResponse response = makeOutgoingResponse(exception, _current);
+    OutputStream* os = &response.outputStream();
+    InputStream is{_instance.get(), os->getEncoding(), *os, true}; // Adopting the OutputStream's buffer.
+    is.pos(sizeof(replyHdr) + 4);
+
+    uint8_t replyStatusByte;
+    is.read(replyStatusByte);
+    throwReplyStatusException(ReplyStatus{replyStatusByte}, is);
+}
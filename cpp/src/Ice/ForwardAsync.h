@@ -0,0 +1,29 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_FORWARD_ASYNC_H
+#define ICE_FORWARD_ASYNC_H
+
+#include "Ice/IncomingRequest.h"
+#include "Ice/OutgoingResponse.h"
+#include "Ice/Proxy.h"
+
+#include <functional>
+
+namespace IceInternal
+{
+    // Forwards an incoming request to the target of proxy, with the operation and mode of the request, and
+    // sends the reply of the forwarded request with sendResponse. A request forwarded with a oneway or datagram proxy
+    // gets an empty response once it's sent, and a request forwarded with a batch proxy once it's queued. This function
+    // must be called by the dispatch of the request, before anything reads the encapsulation of the request.
+    //
+    // The encapsulations of the request and of the reply are not copied when the received messages allow it: the
+    // header of the forwarded request is written in place of the header of the received request, and the header of
+    // the response in place of the header of the reply.
+    ICE_API void forwardAsync(
+        const Ice::ObjectPrx& proxy,
+        Ice::IncomingRequest& request,
+        std::function<void(Ice::OutgoingResponse)> sendResponse,
+        const Ice::Context& context = Ice::noExplicitContext);
+}
+
+#endif
@@ -4,9 +4,11 @@
 #include "HashUtil.h"
 #include "Ice/InputStream.h"
 #include "Ice/LocalExceptions.h"
+#include "Ice/LoggerUtil.h"
 #include "Instance.h"
 #include "NetworkProxy.h"
 #include "ProtocolInstance.h"
+#include "TraceLevels.h"
 
 using namespace std;
 using namespace Ice;
@@ -421,10 +423,15 @@ IceInternal::IPEndpointI::IPEndpointI(ProtocolInstancePtr instance, InputStream*
     s->read(const_cast<int32_t&>(_port));
 }
 
-IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance)
+IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance, size_t threadCount)
     : _instance(instance),
       _protocol(instance->protocolSupport()),
-      _preferIPv6(instance->preferIPv6())
+      _preferIPv6(instance->preferIPv6()),
+      _cacheTimeout(
+          instance->initializationData().properties->getIcePropertyAsInt("Ice.HostResolver.CacheTimeout")),
+      _cacheMaxSize(static_cast<size_t>(
+          max(instance->initializationData().properties->getIcePropertyAsInt("Ice.HostResolver.CacheMaxSize"), 0))),
+      _observers(threadCount)
 {
     updateObserver();
 }
@@ -438,8 +445,8 @@ IceInternal::EndpointHostResolver::resolve(
     function<void(exception_ptr)> exception)
 {
     //
-    // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // Try to get the addresses without DNS lookup. If this doesn't work, we check the cache and otherwise queue a
+    // resolve entry and a resolver thread will take care of getting the endpoint addresses.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if (!networkProxy)
@@ -460,28 +467,53 @@ IceInternal::EndpointHostResolver::resolve(
         }
     }
 
-    lock_guard lock(_mutex);
-    assert(!_destroyed);
+    Key key{host, port};
+    vector<Address> cachedAddresses;
+    {
+        lock_guard lock(_mutex);
+        assert(!_destroyed);
 
-    ResolveEntry entry;
-    entry.host = host;
-    entry.port = port;
-    entry.endpoint = endpoint;
-    entry.response = std::move(response);
-    entry.exception = std::move(exception);
+        // The addresses resolved through a network proxy are not cached.
+        if (!networkProxy)
+        {
+            cachedAddresses = findCachedAddresses(key);
+        }
 
-    const CommunicatorObserverPtr& observer = _instance->initializationData().observer;
-    if (observer)
-    {
-        entry.observer = observer->getEndpointLookupObserver(endpoint);
-        if (entry.observer)
+        if (cachedAddresses.empty())
         {
-            entry.observer->attach();
+            ResolveEntry entry;
+            entry.endpoint = endpoint;
+            entry.response = std::move(response);
+            entry.exception = std::move(exception);
+
+            const CommunicatorObserverPtr& observer = _instance->initializationData().observer;
+            if (observer)
+            {
+                entry.observer = observer->getEndpointLookupObserver(endpoint);
+                if (entry.observer)
+                {
+                    entry.observer->attach();
+                }
+            }
+
+            // If a lookup of the same host and port is queued or in progress, the entry waits for its result.
+            auto p = _pending.find(key);
+            if (p != _pending.end())
+            {
+                p->second.push_back(std::move(entry));
+                ++_coalescedLookups;
+            }
+            else
+            {
+                _pending[key].push_back(std::move(entry));
+                _queue.push_back(std::move(key));
+                _conditionVariable.notify_one();
+            }
+            return;
         }
     }
 
-    _queue.push_back(entry);
-    _conditionVariable.notify_one();
+    response(endpoint->connectors(cachedAddresses, nullptr));
 }
 
 void
@@ -490,15 +522,24 @@ IceInternal::EndpointHostResolver::destroy()
     lock_guard lock(_mutex);
     assert(!_destroyed);
     _destroyed = true;
-    _conditionVariable.notify_one();
+    _conditionVariable.notify_all();
+
+    if (_instance->traceLevels()->network >= 2 && _lookups + _cacheHits + _coalescedLookups > 0)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "host resolver statistics\n";
+        out << "lookups = " << _lookups << '\n';
+        out << "cache hits = " << _cacheHits << '\n';
+        out << "coalesced lookups = " << _coalescedLookups;
+    }
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::run(size_t index)
 {
     while (true)
     {
-        ResolveEntry r;
+        Key key;
         ThreadObserverPtr threadObserver;
         {
             unique_lock lock(_mutex);
@@ -509,9 +550,10 @@ IceInternal::EndpointHostResolver::run()
                 break;
             }
 
-            r = _queue.front();
+            key = std::move(_queue.front());
             _queue.pop_front();
-            threadObserver = _observer.get();
+            ++_lookups;
+            threadObserver = _observers[index].get();
         }
 
         if (threadObserver)
@@ -519,9 +561,11 @@ IceInternal::EndpointHostResolver::run()
             threadObserver->stateChanged(ThreadState::ThreadStateIdle, ThreadState::ThreadStateInUseForOther);
         }
 
+        NetworkProxyPtr networkProxy = _instance->networkProxy();
+        vector<Address> addresses;
+        exception_ptr lookupException;
         try
         {
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
             ProtocolSupport protocol = _protocol;
             if (networkProxy)
             {
@@ -532,51 +576,133 @@ IceInternal::EndpointHostResolver::run()
                 }
             }
 
-            vector<Address> addresses = getAddresses(r.host, r.port, protocol, _preferIPv6, true);
-            if (r.observer)
+            addresses = getAddresses(key.first, key.second, protocol, _preferIPv6, true);
+        }
+        catch (const Ice::LocalException&)
+        {
+            lookupException = current_exception();
+        }
+
+        vector<ResolveEntry> entries;
+        {
+            lock_guard lock(_mutex);
+            auto p = _pending.find(key);
+            if (p != _pending.end())
             {
-                r.observer->detach();
-                r.observer = nullptr;
+                entries = std::move(p->second);
+                _pending.erase(p);
             }
 
-            r.response(r.endpoint->connectors(addresses, networkProxy));
-
-            if (threadObserver)
+            if (!lookupException && !networkProxy)
             {
-                threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther, ThreadState::ThreadStateIdle);
+                addCachedAddresses(key, addresses);
             }
         }
-        catch (const Ice::LocalException& ex)
+
+        for (auto& r : entries)
         {
-            if (threadObserver)
+            try
             {
-                threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther, ThreadState::ThreadStateIdle);
+                if (lookupException)
+                {
+                    rethrow_exception(lookupException);
+                }
+
+                if (r.observer)
+                {
+                    r.observer->detach();
+                    r.observer = nullptr;
+                }
+
+                r.response(r.endpoint->connectors(addresses, networkProxy));
             }
-            if (r.observer)
+            catch (const Ice::LocalException& ex)
             {
-                r.observer->failed(ex.ice_id());
-                r.observer->detach();
+                if (r.observer)
+                {
+                    r.observer->failed(ex.ice_id());
+                    r.observer->detach();
+                }
+                r.exception(current_exception());
             }
-            r.exception(current_exception());
+        }
+
+        if (threadObserver)
+        {
+            threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther, ThreadState::ThreadStateIdle);
         }
     }
 
-    for (const auto& p : _queue)
+    // The first resolver thread to terminate fails the entries that are still pending.
+    map<Key, vector<ResolveEntry>> pending;
     {
-        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if (p.observer)
+        lock_guard lock(_mutex);
+        pending.swap(_pending);
+        _queue.clear();
+        _observers[index].detach();
+    }
+
+    for (const auto& [key, entries] : pending)
+    {
+        for (const auto& p : entries)
         {
-            p.observer->failed(ex.ice_id());
-            p.observer->detach();
+            Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
+            if (p.observer)
+            {
+                p.observer->failed(ex.ice_id());
+                p.observer->detach();
+            }
+            p.exception(make_exception_ptr(ex));
         }
-        p.exception(make_exception_ptr(ex));
     }
-    _queue.clear();
+}
 
-    if (_observer)
+vector<Address>
+IceInternal::EndpointHostResolver::findCachedAddresses(const Key& key)
+{
+    auto p = _cache.find(key);
+    if (p == _cache.end())
     {
-        _observer.detach();
+        return {};
     }
+
+    if (chrono::steady_clock::now() - p->second.time >= _cacheTimeout)
+    {
+        _lru.erase(p->second.lru);
+        _cache.erase(p);
+        return {};
+    }
+
+    _lru.splice(_lru.begin(), _lru, p->second.lru);
+    ++_cacheHits;
+    return p->second.addresses;
+}
+
+void
+IceInternal::EndpointHostResolver::addCachedAddresses(const Key& key, const vector<Address>& addresses)
+{
+    if (_cacheTimeout <= chrono::seconds::zero() || addresses.empty())
+    {
+        return;
+    }
+
+    auto now = chrono::steady_clock::now();
+    auto p = _cache.find(key);
+    if (p != _cache.end())
+    {
+        p->second.time = now;
+        p->second.addresses = addresses;
+        _lru.splice(_lru.begin(), _lru, p->second.lru);
+        return;
+    }
+
+    if (_cacheMaxSize > 0 && _cache.size() >= _cacheMaxSize)
+    {
+        _cache.erase(_lru.back());
+        _lru.pop_back();
+    }
+    _lru.push_front(key);
+    _cache.emplace(key, CacheEntry{now, addresses, _lru.begin()});
 }
 
 void
@@ -586,8 +712,12 @@ IceInternal::EndpointHostResolver::updateObserver()
     const CommunicatorObserverPtr& observer = _instance->initializationData().observer;
     if (observer)
     {
-        _observer.attach(
-            observer
-                ->getThreadObserver("Communicator", "Ice.HostResolver", ThreadState::ThreadStateIdle, _observer.get()));
+        // With several resolver threads, each thread has its own observer and name.
+        for (size_t i = 0; i < _observers.size(); ++i)
+        {
+            string name = _observers.size() == 1 ? "Ice.HostResolver" : "Ice.HostResolver-" + to_string(i);
+            _observers[i].attach(
+                observer->getThreadObserver("Communicator", name, ThreadState::ThreadStateIdle, _observers[i].get()));
+        }
     }
 }
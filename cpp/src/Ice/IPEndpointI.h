@@ -10,9 +10,14 @@
 #include "Network.h"
 #include "ProtocolInstanceF.h"
 
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
+#include <list>
+#include <map>
 #include <mutex>
+#include <vector>
 
 namespace IceInternal
 {
@@ -65,10 +70,15 @@ namespace IceInternal
         const std::string _connectionId;
     };
 
+    //
+    // Resolves the host names of the endpoints with the Ice.HostResolver.Size resolver threads. Concurrent lookups of
+    // the same host and port are coalesced into a single DNS query, and the resolved addresses are cached for
+    // Ice.HostResolver.CacheTimeout seconds when this property is set to a value greater than 0.
+    //
     class ICE_API EndpointHostResolver final
     {
     public:
-        EndpointHostResolver(const InstancePtr&);
+        EndpointHostResolver(const InstancePtr&, std::size_t);
 
         void resolve(
             const std::string&,
@@ -78,26 +88,53 @@ namespace IceInternal
             std::function<void(std::exception_ptr)>);
         void destroy();
 
-        void run();
+        // Runs the resolver thread with the given index, from 0 to the number of threads minus 1.
+        void run(std::size_t);
         void updateObserver();
 
     private:
         struct ResolveEntry
         {
-            std::string host;
-            int port;
             IPEndpointIPtr endpoint;
             std::function<void(std::vector<ConnectorPtr>)> response;
             std::function<void(std::exception_ptr)> exception;
             Ice::Instrumentation::ObserverPtr observer;
         };
 
+        using Key = std::pair<std::string, int>;
+
+        struct CacheEntry
+        {
+            std::chrono::steady_clock::time_point time;
+            std::vector<Address> addresses;
+            std::list<Key>::iterator lru;
+        };
+
+        // Returns the cached addresses of the given host and port, or an empty vector if they are not cached or
+        // expired.
+        std::vector<Address> findCachedAddresses(const Key&);
+        void addCachedAddresses(const Key&, const std::vector<Address>&);
+
         const InstancePtr _instance;
         const IceInternal::ProtocolSupport _protocol;
         const bool _preferIPv6;
+        const std::chrono::seconds _cacheTimeout;
+        const std::size_t _cacheMaxSize;
         bool _destroyed{false};
-        std::deque<ResolveEntry> _queue;
-        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+
+        // The lookups waiting for a resolver thread, and the entries waiting for the lookup of their host and port.
+        std::deque<Key> _queue;
+        std::map<Key, std::vector<ResolveEntry>> _pending;
+
+        std::map<Key, CacheEntry> _cache;
+        std::list<Key> _lru; // The most recently used key first.
+
+        std::uint64_t _lookups{0};
+        std::uint64_t _cacheHits{0};
+        std::uint64_t _coalescedLookups{0};
+
+        // The observers of the resolver threads, indexed like the threads.
+        std::vector<ObserverHelperT<Ice::Instrumentation::ThreadObserver>> _observers;
         std::mutex _mutex;
         std::condition_variable _conditionVariable;
     };
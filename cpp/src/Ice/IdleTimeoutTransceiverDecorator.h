@@ -47,6 +47,7 @@ namespace IceInternal
 
         SocketOperation write(Buffer&) final;
         SocketOperation read(Buffer&) final;
+        SocketOperation gatherWrite(const std::vector<Buffer*>&) final;
 
 #if defined(ICE_USE_IOCP)
         bool startWrite(Buffer&) final;
@@ -111,12 +111,14 @@ Ice::InputStream::InputStream(InputStream&& other) noexcept
     : InputStream{other._instance, other._encoding, std::move(other)} // only moves (and resets) the base class
 {
     _closure = other._closure;
+    _memoryResource = other._memoryResource;
     _startSeq = other._startSeq;
     _minSeqSize = other._minSeqSize;
 
     // Reset other to its default state
     other.resetEncapsulation();
     other._closure = nullptr;
+    other._memoryResource = nullptr;
     other._startSeq = -1;
     other._minSeqSize = 0;
 }
@@ -132,6 +134,7 @@ Ice::InputStream::operator=(InputStream&& other) noexcept
 
         _encoding = other._encoding;
         _closure = other._closure;
+        _memoryResource = other._memoryResource;
         _startSeq = other._startSeq;
         _minSeqSize = other._minSeqSize;
         _startSeq = -1;
@@ -141,6 +144,7 @@ Ice::InputStream::operator=(InputStream&& other) noexcept
         // Reset other to its default state.
         other.resetEncapsulation();
         other._closure = nullptr;
+        other._memoryResource = nullptr;
         other._startSeq = -1;
         other._minSeqSize = 0;
     }
@@ -183,6 +187,7 @@ Ice::InputStream::swap(InputStream& other) noexcept
 
     std::swap(_encoding, other._encoding);
     std::swap(_closure, other._closure);
+    std::swap(_memoryResource, other._memoryResource);
     std::swap(_startSeq, other._startSeq);
     std::swap(_minSeqSize, other._minSeqSize);
 
@@ -494,6 +499,29 @@ Ice::InputStream::read(pair<const byte*, const byte*>& v)
     }
 }
 
+void
+Ice::InputStream::read(SharedByteSeq& v)
+{
+    int32_t sz = readAndCheckSeqSize(1);
+    if (sz > 0)
+    {
+        shared_ptr<const byte> owner = b.share();
+        if (owner)
+        {
+            v = SharedByteSeq{std::move(owner), i, static_cast<size_t>(sz)};
+        }
+        else
+        {
+            v = vector<byte>(i, i + sz);
+        }
+        i += sz;
+    }
+    else
+    {
+        v = SharedByteSeq{};
+    }
+}
+
 void
 Ice::InputStream::read(vector<bool>& v)
 {
@@ -898,6 +926,35 @@ Ice::InputStream::read(std::string& v, bool convert)
     }
 }
 
+void
+Ice::InputStream::read(std::pmr::string& v, bool convert)
+{
+    // The string keeps its own allocator.
+    int32_t sz = readSize();
+    if (sz > 0)
+    {
+        if (b.end() - i < sz)
+        {
+            throwUnmarshalOutOfBoundsException(__FILE__, __LINE__);
+        }
+
+        string converted;
+        if (convert && readConverted(converted, sz))
+        {
+            v.assign(converted);
+        }
+        else
+        {
+            v.assign(reinterpret_cast<const char*>(&*i), static_cast<size_t>(sz));
+        }
+        i += sz;
+    }
+    else
+    {
+        v.clear();
+    }
+}
+
 void
 Ice::InputStream::read(const char*& vdata, size_t& vsize, bool convert)
 {
@@ -1044,6 +1101,7 @@ Ice::InputStream::InputStream(Instance* instance, EncodingVersion encoding, Buff
       _currentEncaps(nullptr),
       _classGraphDepthMax(instance->classGraphDepthMax()),
       _closure(nullptr),
+      _memoryResource(nullptr),
       _startSeq(-1),
       _minSeqSize(0),
       _valueFactoryManager(instance->initializationData().valueFactoryManager)
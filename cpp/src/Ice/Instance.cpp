@@ -1,7 +1,9 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Instance.h"
+#include "BufferPool.h"
 #include "CheckIdentity.h"
+#include "CompressionCodec.h"
 #include "ConnectionFactory.h"
 #include "ConsoleUtil.h"
 #include "DefaultsAndOverrides.h"
@@ -1126,6 +1128,24 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
             }
         }
 
+        {
+            string codec = _initData.properties->getIceProperty("Ice.Compression.Codec");
+            const CompressionCodec* compressionCodec = findCompressionCodec(codec);
+            if (!compressionCodec && (codec == "zstd" || codec == "lz4"))
+            {
+                // Not supported by this build: fall back to bzip2, like with peers that don't support the codec.
+                compressionCodec = findCompressionCodec("bzip2");
+            }
+            const_cast<const CompressionCodec*&>(_compressionCodec) = compressionCodec;
+            if (!_compressionCodec)
+            {
+                throw InitializationException(
+                    __FILE__,
+                    __LINE__,
+                    "'" + codec + "' is not a valid value for Ice.Compression.Codec");
+            }
+        }
+
         string toStringModeStr = _initData.properties->getIceProperty("Ice.ToStringMode");
         if (toStringModeStr == "ASCII")
         {
@@ -1303,7 +1323,7 @@ IceInternal::Instance::~Instance()
     assert(!_clientThreadPool);
     assert(!_serverThreadPool);
     assert(!_endpointHostResolver);
-    assert(!_endpointHostResolverThread.joinable());
+    assert(_endpointHostResolverThreads.empty());
     assert(!_retryQueue);
     assert(!_timer);
     assert(!_routerManager);
@@ -1464,8 +1484,12 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
 
     try
     {
-        _endpointHostResolver = make_shared<EndpointHostResolver>(shared_from_this());
-        _endpointHostResolverThread = std::thread([this] { _endpointHostResolver->run(); });
+        auto size = static_cast<size_t>(max(_initData.properties->getIcePropertyAsInt("Ice.HostResolver.Size"), 1));
+        _endpointHostResolver = make_shared<EndpointHostResolver>(shared_from_this(), size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            _endpointHostResolverThreads.emplace_back([this, i] { _endpointHostResolver->run(i); });
+        }
     }
     catch (const Ice::Exception& ex)
     {
@@ -1655,6 +1679,23 @@ IceInternal::Instance::destroy()
     }
     if (_timer)
     {
+        if (_traceLevels->threadPool >= 1)
+        {
+            Timer::Statistics statistics = _timer->getStatistics();
+            Trace out(_initData.logger, _traceLevels->threadPoolCat);
+            out << "Ice.Timer statistics:";
+            out << "\nscheduled tasks = " << statistics.scheduledTasks;
+            out << "\nmax scheduled tasks = " << statistics.maxScheduledTasks;
+            out << "\nrun tasks = " << statistics.runTasks;
+            if (statistics.runTasks > 0)
+            {
+                auto averageLateness = statistics.totalLateness / statistics.runTasks;
+                out << "\naverage lateness = "
+                    << chrono::duration_cast<chrono::microseconds>(averageLateness).count() << "us";
+                out << "\nmax lateness = "
+                    << chrono::duration_cast<chrono::microseconds>(statistics.maxLateness).count() << "us";
+            }
+        }
         _timer->destroy();
     }
 
@@ -1669,9 +1710,26 @@ IceInternal::Instance::destroy()
     {
         _serverThreadPool->joinWithAllThreads();
     }
-    if (_endpointHostResolverThread.joinable())
+    for (auto& thread : _endpointHostResolverThreads)
     {
-        _endpointHostResolverThread.join();
+        thread.join();
+    }
+    _endpointHostResolverThreads.clear();
+
+    if (_traceLevels->threadPool >= 1)
+    {
+        // The buffer pool is shared by all the communicators of the process.
+        BufferPool::Stats statistics = BufferPool::getProcessStats();
+        Trace out(_initData.logger, _traceLevels->threadPoolCat);
+        out << "buffer pool statistics:";
+        out << "\nhits = " << statistics.hits;
+        out << "\nmisses = " << statistics.misses;
+        if (statistics.hits + statistics.misses > 0)
+        {
+            out << "\nhit rate = " << (statistics.hits * 100 / (statistics.hits + statistics.misses)) << "%";
+        }
+        out << "\nthreads with a cache = " << statistics.threads;
+        out << "\ncached bytes = " << statistics.cachedBytes;
     }
 
     if (_routerManager)
@@ -41,6 +41,8 @@ namespace IceInternal
     class MetricsAdminI;
     using MetricsAdminIPtr = std::shared_ptr<MetricsAdminI>;
 
+    class CompressionCodec;
+
     //
     // Structure to track warnings for attempts to set socket buffer sizes
     //
@@ -87,6 +89,7 @@ namespace IceInternal
         [[nodiscard]] size_t messageSizeMax() const { return _messageSizeMax; }
         [[nodiscard]] size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
         [[nodiscard]] size_t classGraphDepthMax() const { return _classGraphDepthMax; }
+        [[nodiscard]] const CompressionCodec* compressionCodec() const { return _compressionCodec; }
         [[nodiscard]] Ice::ToStringMode toStringMode() const { return _toStringMode; }
         [[nodiscard]] bool acceptClassCycles() const { return _acceptClassCycles; }
 
@@ -152,6 +155,7 @@ namespace IceInternal
         const size_t _messageSizeMax{0};                                   // Immutable, not reset by destroy().
         const size_t _batchAutoFlushSize{0};                               // Immutable, not reset by destroy().
         const size_t _classGraphDepthMax{0};                               // Immutable, not reset by destroy().
+        const CompressionCodec* const _compressionCodec{nullptr};          // Immutable, not reset by destroy().
         const Ice::ToStringMode _toStringMode{Ice::ToStringMode::Unicode}; // Immutable, not reset by destroy().
         const bool _acceptClassCycles{false};                              // Immutable, not reset by destroy().
         Ice::ConnectionOptions _clientConnectionOptions;
@@ -167,7 +171,7 @@ namespace IceInternal
         ThreadPoolPtr _clientThreadPool;
         ThreadPoolPtr _serverThreadPool;
         EndpointHostResolverPtr _endpointHostResolver;
-        std::thread _endpointHostResolverThread;
+        std::vector<std::thread> _endpointHostResolverThreads;
         RetryQueuePtr _retryQueue;
         std::vector<int> _retryIntervals;
         ThreadObserverTimerPtr _timer;
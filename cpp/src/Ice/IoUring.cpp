@@ -0,0 +1,316 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "IoUring.h"
+#include "Ice/LocalExceptions.h"
+
+#if defined(ICE_USE_IO_URING)
+
+#    include <linux/io_uring.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+
+#    include <algorithm>
+#    include <cassert>
+#    include <cerrno>
+#    include <cstring>
+#    include <ctime>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+    inline unsigned int loadAcquire(const unsigned int* p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+
+    inline void storeRelease(unsigned int* p, unsigned int v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+
+    void* mapRing(int fd, size_t size, off_t offset)
+    {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+}
+
+IceInternal::IoUring::~IoUring() { close(); }
+
+bool
+IceInternal::IoUring::setup(unsigned int entries)
+{
+    assert(_fd < 0);
+
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    // Make the completion queue larger than the submission queue: each submitted request generates a completion
+    // and cancelled requests generate two completions.
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = entries * 4;
+
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0)
+    {
+        return false;
+    }
+    _fd = fd;
+
+    // IORING_FEAT_EXT_ARG is required to wait for completions with a timeout and IORING_FEAT_NODROP ensures that
+    // completions are never dropped if the completion queue overflows.
+    if (!(params.features & IORING_FEAT_EXT_ARG) || !(params.features & IORING_FEAT_NODROP))
+    {
+        close();
+        errno = ENOSYS;
+        return false;
+    }
+
+    _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _sqRingSize = _cqRingSize = max(_sqRingSize, _cqRingSize);
+    }
+
+    _sqRing = mapRing(_fd, _sqRingSize, IORING_OFF_SQ_RING);
+    if (!_sqRing)
+    {
+        int error = errno;
+        close();
+        errno = error;
+        return false;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _cqRing = _sqRing;
+    }
+    else
+    {
+        _cqRing = mapRing(_fd, _cqRingSize, IORING_OFF_CQ_RING);
+        if (!_cqRing)
+        {
+            int error = errno;
+            close();
+            errno = error;
+            return false;
+        }
+    }
+
+    _sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    _sqes = static_cast<io_uring_sqe*>(mapRing(_fd, _sqesSize, IORING_OFF_SQES));
+    if (!_sqes)
+    {
+        int error = errno;
+        close();
+        errno = error;
+        return false;
+    }
+
+    auto sq = static_cast<char*>(_sqRing);
+    _sqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+    _sqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+    _sqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+    _sqMask = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+    _sqEntries = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_entries);
+
+    auto cq = static_cast<char*>(_cqRing);
+    _cqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+    _cqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+    _cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    _cqMask = *reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+    return true;
+}
+
+void
+IceInternal::IoUring::close()
+{
+    if (_sqes)
+    {
+        munmap(_sqes, _sqesSize);
+        _sqes = nullptr;
+    }
+    if (_cqRing && _cqRing != _sqRing)
+    {
+        munmap(_cqRing, _cqRingSize);
+    }
+    _cqRing = nullptr;
+    if (_sqRing)
+    {
+        munmap(_sqRing, _sqRingSize);
+        _sqRing = nullptr;
+    }
+    if (_fd >= 0)
+    {
+        ::close(_fd);
+        _fd = -1;
+    }
+    _toSubmit = 0;
+}
+
+void
+IceInternal::IoUring::pollAdd(SOCKET fd, uint32_t events, uint64_t userData)
+{
+    io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(io_uring_sqe));
+    sqe.opcode = IORING_OP_POLL_ADD;
+    sqe.fd = fd;
+#    if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    // The kernel expects the 16-bit halves of the 32-bit poll mask to be swapped on big-endian hosts.
+    events = (events << 16) | (events >> 16);
+#    endif
+    sqe.poll32_events = events;
+    sqe.user_data = userData;
+    push(sqe);
+}
+
+void
+IceInternal::IoUring::recv(SOCKET fd, void* buffer, size_t length, uint64_t userData)
+{
+    io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(io_uring_sqe));
+    sqe.opcode = IORING_OP_RECV;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<uint64_t>(buffer);
+    sqe.len = static_cast<uint32_t>(length);
+    sqe.user_data = userData;
+    push(sqe);
+}
+
+void
+IceInternal::IoUring::send(SOCKET fd, const void* buffer, size_t length, uint64_t userData)
+{
+    io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(io_uring_sqe));
+    sqe.opcode = IORING_OP_SEND;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<uint64_t>(buffer);
+    sqe.len = static_cast<uint32_t>(length);
+    sqe.msg_flags = MSG_NOSIGNAL;
+    sqe.user_data = userData;
+    push(sqe);
+}
+
+void
+IceInternal::IoUring::cancel(uint64_t target, uint64_t userData)
+{
+    io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(io_uring_sqe));
+    sqe.opcode = IORING_OP_ASYNC_CANCEL;
+    sqe.fd = -1;
+    sqe.addr = target;
+    sqe.user_data = userData;
+    push(sqe);
+}
+
+void
+IceInternal::IoUring::submit()
+{
+    assert(_fd >= 0);
+    while (_toSubmit > 0 && enter(_toSubmit, 0, 0, nullptr) < 0)
+    {
+        if (errno != EINTR)
+        {
+            throw Ice::SocketException(__FILE__, __LINE__, errno);
+        }
+    }
+}
+
+int
+IceInternal::IoUring::wait(vector<Completion>& completions, int timeout)
+{
+    assert(_fd >= 0);
+    completions.clear();
+
+    // Don't wait if there are already completions to process.
+    if (loadAcquire(_cqTail) != *_cqHead)
+    {
+        timeout = 0;
+    }
+
+    __kernel_timespec ts;
+    io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    if (timeout >= 0)
+    {
+        ts.tv_sec = timeout / 1000;
+        ts.tv_nsec = static_cast<long long>(timeout % 1000) * 1000000;
+        arg.ts = reinterpret_cast<uint64_t>(&ts);
+    }
+
+    unsigned int toSubmit = _toSubmit;
+    if (timeout != 0 || toSubmit > 0)
+    {
+        // A single system call submits the queued requests and waits for completions.
+        ++_waitCalls;
+        int rs = enter(toSubmit, timeout != 0 ? 1 : 0, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg);
+        if (rs < 0 && errno != ETIME)
+        {
+            return -1;
+        }
+    }
+
+    unsigned int head = *_cqHead;
+    unsigned int tail = loadAcquire(_cqTail);
+    for (; head != tail; ++head)
+    {
+        const io_uring_cqe& cqe = _cqes[head & _cqMask];
+        completions.push_back({cqe.user_data, cqe.res});
+    }
+    storeRelease(_cqHead, head);
+    _completed += completions.size();
+    return static_cast<int>(completions.size());
+}
+
+IoUring::Statistics
+IceInternal::IoUring::getStatistics() const
+{
+    return {_enterCalls, _waitCalls, _submitted, _completed};
+}
+
+void
+IceInternal::IoUring::push(const io_uring_sqe& sqe)
+{
+    assert(_fd >= 0);
+
+    unsigned int tail = *_sqTail;
+    if (tail - loadAcquire(_sqHead) == _sqEntries)
+    {
+        // The submission queue is full, submit the queued requests to make room for the new request.
+        while (enter(_toSubmit, 0, 0, nullptr) < 0)
+        {
+            if (errno != EINTR)
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, errno);
+            }
+        }
+    }
+
+    unsigned int index = tail & _sqMask;
+    _sqes[index] = sqe;
+    _sqArray[index] = index;
+    storeRelease(_sqTail, tail + 1);
+    ++_toSubmit;
+}
+
+int
+IceInternal::IoUring::enter(unsigned int toSubmit, unsigned int minComplete, unsigned int flags, void* arg)
+{
+    ++_enterCalls;
+    int rs = static_cast<int>(syscall(
+        __NR_io_uring_enter,
+        _fd,
+        toSubmit,
+        minComplete,
+        flags,
+        arg,
+        arg ? sizeof(io_uring_getevents_arg) : 0));
+    if (rs >= 0)
+    {
+        // The requests can be submitted concurrently by submit and wait, the kernel submits each queued request once
+        // and returns the number of requests submitted by this call.
+        assert(static_cast<unsigned int>(rs) <= _toSubmit);
+        _toSubmit -= static_cast<unsigned int>(rs);
+        _submitted += static_cast<unsigned int>(rs);
+    }
+    return rs;
+}
+
+#endif
@@ -0,0 +1,111 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_IO_URING_H
+#define ICE_IO_URING_H
+
+#include "Network.h"
+
+#if defined(ICE_USE_IO_URING)
+
+#    include <atomic>
+#    include <cstdint>
+#    include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace IceInternal
+{
+    //
+    // Minimal io_uring wrapper used by the selector. It uses the raw system calls (there's no dependency on
+    // liburing) and only provides the poll, receive, send and cancel operations used by the selector.
+    //
+    // The wrapper isn't thread-safe, the caller must ensure that requests are queued and submitted from a single
+    // thread at a time. Requests can however be queued and submitted with submit while another thread waits for
+    // completions with wait: only wait reads the completion queue.
+    //
+    class IoUring final
+    {
+    public:
+        struct Completion
+        {
+            std::uint64_t userData;
+            std::int32_t result;
+        };
+
+        struct Statistics
+        {
+            std::uint64_t enterCalls; // The number of io_uring_enter system calls.
+            std::uint64_t waitCalls;  // The number of io_uring_enter system calls that waited for completions.
+            std::uint64_t submitted;  // The number of submitted requests.
+            std::uint64_t completed;  // The number of completions.
+        };
+
+        IoUring() = default;
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        // Creates the ring. Returns false and sets errno if io_uring isn't available or if the kernel doesn't
+        // provide the required features (Linux 5.11 or greater is required).
+        bool setup(unsigned int);
+        void close();
+
+        // Queues a one-shot poll request for the given socket and poll events.
+        void pollAdd(SOCKET, std::uint32_t, std::uint64_t);
+
+        // Queues a receive request for the given socket and buffer.
+        void recv(SOCKET, void*, std::size_t, std::uint64_t);
+
+        // Queues a send request for the given socket and buffer.
+        void send(SOCKET, const void*, std::size_t, std::uint64_t);
+
+        // Queues the cancellation of the request with the given user data.
+        void cancel(std::uint64_t, std::uint64_t);
+
+        // Submits the queued requests without waiting for completions.
+        void submit();
+
+        // Submits the queued requests and waits up to the given timeout in milliseconds for completions (-1 waits
+        // indefinitely). The completions are copied to the given vector. Returns the number of completions or -1
+        // and sets errno on failure.
+        int wait(std::vector<Completion>&, int);
+
+        [[nodiscard]] Statistics getStatistics() const;
+
+    private:
+        void push(const io_uring_sqe&);
+        int enter(unsigned int, unsigned int, unsigned int, void*);
+
+        int _fd{-1};
+        std::atomic<unsigned int> _toSubmit{0};
+
+        std::atomic<std::uint64_t> _enterCalls{0};
+        std::uint64_t _waitCalls{0};
+        std::atomic<std::uint64_t> _submitted{0};
+        std::uint64_t _completed{0};
+
+        void* _sqRing{nullptr};
+        std::size_t _sqRingSize{0};
+        void* _cqRing{nullptr};
+        std::size_t _cqRingSize{0};
+        io_uring_sqe* _sqes{nullptr};
+        std::size_t _sqesSize{0};
+
+        unsigned int* _sqHead{nullptr};
+        unsigned int* _sqTail{nullptr};
+        unsigned int* _sqArray{nullptr};
+        unsigned int _sqMask{0};
+        unsigned int _sqEntries{0};
+
+        unsigned int* _cqHead{nullptr};
+        unsigned int* _cqTail{nullptr};
+        io_uring_cqe* _cqes{nullptr};
+        unsigned int _cqMask{0};
+    };
+}
+
+#endif
+
+#endif
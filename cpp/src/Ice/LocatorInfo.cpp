@@ -77,6 +77,8 @@ namespace
 
 IceInternal::LocatorManager::LocatorManager(const Ice::PropertiesPtr& properties)
     : _background(properties->getIcePropertyAsInt("Ice.BackgroundLocatorCacheUpdates") > 0),
+      _cacheMaxSize(static_cast<size_t>(max(properties->getIcePropertyAsInt("Ice.LocatorCache.MaxSize"), 0))),
+      _notRegisteredTimeout(chrono::seconds(properties->getIcePropertyAsInt("Ice.LocatorCache.NotRegisteredTimeout"))),
       _tableHint(_table.end())
 {
 }
@@ -134,7 +136,9 @@ IceInternal::LocatorManager::get(const LocatorPrx& loc)
         {
             t = _locatorTables.insert(
                 _locatorTables.begin(),
-                pair<const pair<Identity, EncodingVersion>, LocatorTablePtr>(locatorKey, new LocatorTable()));
+                pair<const pair<Identity, EncodingVersion>, LocatorTablePtr>(
+                    locatorKey,
+                    make_shared<LocatorTable>(_cacheMaxSize, _notRegisteredTimeout)));
         }
 
         _tableHint = _table.insert(
@@ -149,7 +153,12 @@ IceInternal::LocatorManager::get(const LocatorPrx& loc)
     return _tableHint->second;
 }
 
-IceInternal::LocatorTable::LocatorTable() = default;
+IceInternal::LocatorTable::LocatorTable(size_t maxSize, chrono::milliseconds notRegisteredTimeout)
+    : _notRegisteredTimeout(notRegisteredTimeout),
+      _adapterEndpointsMap(maxSize),
+      _objectMap(maxSize)
+{
+}
 
 void
 IceInternal::LocatorTable::clear()
@@ -158,13 +167,18 @@ IceInternal::LocatorTable::clear()
 
     _adapterEndpointsMap.clear();
     _objectMap.clear();
+    _hits = 0;
+    _expiredHits = 0;
+    _notRegisteredHits = 0;
+    _misses = 0;
 }
 
 bool
 IceInternal::LocatorTable::getAdapterEndpoints(
     const string& adapter,
     chrono::milliseconds ttl,
-    vector<EndpointIPtr>& endpoints)
+    vector<EndpointIPtr>& endpoints,
+    bool& notRegistered)
 {
     if (ttl == 0ms) // No locator cache.
     {
@@ -173,13 +187,26 @@ IceInternal::LocatorTable::getAdapterEndpoints(
 
     lock_guard lock(_mutex);
 
-    auto p = _adapterEndpointsMap.find(adapter);
+    auto entry = _adapterEndpointsMap.find(adapter);
+    if (!entry)
+    {
+        ++_misses;
+        return false;
+    }
+    else if (entry->notRegistered)
+    {
+        notRegistered = checkTTL(entry->time, _notRegisteredTimeout) && checkTTL(entry->time, ttl);
+        ++(notRegistered ? _notRegisteredHits : _misses);
+        return false;
+    }
 
-    if (p != _adapterEndpointsMap.end())
+    endpoints = entry->value;
+    if (checkTTL(entry->time, ttl))
     {
-        endpoints = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        ++_hits;
+        return true;
     }
+    ++_expiredHits;
     return false;
 }
 
@@ -187,16 +214,20 @@ void
 IceInternal::LocatorTable::addAdapterEndpoints(const string& adapter, const vector<EndpointIPtr>& endpoints)
 {
     lock_guard lock(_mutex);
+    _adapterEndpointsMap.put(adapter, endpoints, false);
+}
 
-    auto p = _adapterEndpointsMap.find(adapter);
-
-    if (p != _adapterEndpointsMap.end())
+void
+IceInternal::LocatorTable::addAdapterNotRegistered(const string& adapter)
+{
+    lock_guard lock(_mutex);
+    if (_notRegisteredTimeout > 0ms)
     {
-        p->second = make_pair(chrono::steady_clock::now(), endpoints);
+        _adapterEndpointsMap.put(adapter, {}, true);
     }
     else
     {
-        _adapterEndpointsMap.insert(make_pair(adapter, make_pair(chrono::steady_clock::now(), endpoints)));
+        _adapterEndpointsMap.remove(adapter);
     }
 }
 
@@ -204,22 +235,15 @@ vector<EndpointIPtr>
 IceInternal::LocatorTable::removeAdapterEndpoints(const string& adapter)
 {
     lock_guard lock(_mutex);
-
-    auto p = _adapterEndpointsMap.find(adapter);
-    if (p == _adapterEndpointsMap.end())
-    {
-        return {};
-    }
-
-    vector<EndpointIPtr> endpoints = p->second.second;
-
-    _adapterEndpointsMap.erase(p);
-
-    return endpoints;
+    return _adapterEndpointsMap.remove(adapter).value_or(vector<EndpointIPtr>{});
 }
 
 bool
-IceInternal::LocatorTable::getObjectReference(const Identity& id, chrono::milliseconds ttl, ReferencePtr& ref)
+IceInternal::LocatorTable::getObjectReference(
+    const Identity& id,
+    chrono::milliseconds ttl,
+    ReferencePtr& ref,
+    bool& notRegistered)
 {
     if (ttl == 0ms) // No locator cache
     {
@@ -228,12 +252,26 @@ IceInternal::LocatorTable::getObjectReference(const Identity& id, chrono::millis
 
     lock_guard lock(_mutex);
 
-    auto p = _objectMap.find(id);
-    if (p != _objectMap.end())
+    auto entry = _objectMap.find(id);
+    if (!entry)
+    {
+        ++_misses;
+        return false;
+    }
+    else if (entry->notRegistered)
+    {
+        notRegistered = checkTTL(entry->time, _notRegisteredTimeout) && checkTTL(entry->time, ttl);
+        ++(notRegistered ? _notRegisteredHits : _misses);
+        return false;
+    }
+
+    ref = entry->value;
+    if (checkTTL(entry->time, ttl))
     {
-        ref = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        ++_hits;
+        return true;
     }
+    ++_expiredHits;
     return false;
 }
 
@@ -241,16 +279,20 @@ void
 IceInternal::LocatorTable::addObjectReference(const Identity& id, const ReferencePtr& ref)
 {
     lock_guard lock(_mutex);
+    _objectMap.put(id, ref, false);
+}
 
-    auto p = _objectMap.find(id);
-
-    if (p != _objectMap.end())
+void
+IceInternal::LocatorTable::addObjectNotRegistered(const Identity& id)
+{
+    lock_guard lock(_mutex);
+    if (_notRegisteredTimeout > 0ms)
     {
-        p->second = make_pair(chrono::steady_clock::now(), ref);
+        _objectMap.put(id, nullptr, true);
     }
     else
     {
-        _objectMap.insert(make_pair(id, make_pair(chrono::steady_clock::now(), ref)));
+        _objectMap.remove(id);
     }
 }
 
@@ -258,16 +300,25 @@ ReferencePtr
 IceInternal::LocatorTable::removeObjectReference(const Identity& id)
 {
     lock_guard lock(_mutex);
+    return _objectMap.remove(id).value_or(nullptr);
+}
 
-    auto p = _objectMap.find(id);
-    if (p == _objectMap.end())
+void
+IceInternal::LocatorTable::traceStatistics(const InstancePtr& instance, const Ice::LocatorPrx& locator)
+{
+    lock_guard lock(_mutex);
+    if (_hits + _expiredHits + _notRegisteredHits + _misses == 0)
     {
-        return nullptr;
+        return;
     }
 
-    ReferencePtr ref = p->second.second;
-    _objectMap.erase(p);
-    return ref;
+    Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+    out << "locator cache statistics\n";
+    out << "locator = " << locator << '\n';
+    out << "hits = " << _hits << '\n';
+    out << "expired hits = " << _expiredHits << '\n';
+    out << "not registered hits = " << _notRegisteredHits << '\n';
+    out << "misses = " << _misses;
 }
 
 bool
@@ -461,6 +512,13 @@ IceInternal::LocatorInfo::destroy()
 {
     lock_guard lock(_mutex);
     _locatorRegistry = nullopt;
+
+    // The table is shared by the locator infos of the same locator, the first destroy call traces and clears it.
+    const InstancePtr& instance = _locator->_getReference()->getInstance();
+    if (instance->traceLevels()->location >= 1)
+    {
+        _table->traceStatistics(instance, _locator);
+    }
     _table->clear();
 }
 
@@ -522,9 +580,15 @@ IceInternal::LocatorInfo::getEndpoints(
     vector<EndpointIPtr> endpoints;
     if (!ref->isWellKnown())
     {
-        if (!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints))
+        bool notRegistered = false;
+        if (!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints, notRegistered))
         {
-            if (_background && !endpoints.empty())
+            if (notRegistered)
+            {
+                getEndpointsNotRegistered(ref, callback);
+                return;
+            }
+            else if (_background && !endpoints.empty())
             {
                 getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, nullptr);
             }
@@ -538,9 +602,15 @@ IceInternal::LocatorInfo::getEndpoints(
     else
     {
         ReferencePtr r;
-        if (!_table->getObjectReference(ref->getIdentity(), ttl, r))
+        bool notRegistered = false;
+        if (!_table->getObjectReference(ref->getIdentity(), ttl, r, notRegistered))
         {
-            if (_background && r)
+            if (notRegistered)
+            {
+                getEndpointsNotRegistered(ref, callback);
+                return;
+            }
+            else if (_background && r)
             {
                 getObjectRequest(ref)->addCallback(ref, nullptr, ttl, nullptr);
             }
@@ -676,6 +746,42 @@ IceInternal::LocatorInfo::getEndpointsException(const ReferencePtr& ref, std::ex
     }
 }
 
+void
+IceInternal::LocatorInfo::getEndpointsNotRegistered(const ReferencePtr& ref, const GetEndpointsCallbackPtr& callback)
+{
+    if (ref->getInstance()->traceLevels()->location >= 1)
+    {
+        Trace out(ref->getInstance()->initializationData().logger, ref->getInstance()->traceLevels()->locationCat);
+        if (ref->isWellKnown())
+        {
+            out << "found not registered well-known object in locator cache\n";
+            out << "well-known proxy = " << ref->toString();
+        }
+        else
+        {
+            out << "found not registered adapter in locator cache\n";
+            out << "adapter = " << ref->getAdapterId();
+        }
+    }
+
+    if (callback)
+    {
+        if (ref->isWellKnown())
+        {
+            callback->setException(make_exception_ptr(NotRegisteredException(
+                __FILE__,
+                __LINE__,
+                "object",
+                Ice::identityToString(ref->getIdentity(), ref->getInstance()->toStringMode()))));
+        }
+        else
+        {
+            callback->setException(
+                make_exception_ptr(NotRegisteredException(__FILE__, __LINE__, "object adapter", ref->getAdapterId())));
+        }
+    }
+}
+
 void
 IceInternal::LocatorInfo::getEndpointsTrace(const ReferencePtr& ref, const vector<EndpointIPtr>& endpoints, bool cached)
 {
@@ -824,9 +930,9 @@ IceInternal::LocatorInfo::finishRequest(
         {
             _table->addAdapterEndpoints(ref->getAdapterId(), proxy->_getReference()->getEndpoints());
         }
-        else if (notRegistered) // If the adapter isn't registered anymore, remove it from the cache.
+        else if (notRegistered) // If the adapter isn't registered anymore, cache it as not registered.
         {
-            _table->removeAdapterEndpoints(ref->getAdapterId());
+            _table->addAdapterNotRegistered(ref->getAdapterId());
         }
 
         lock_guard lock(_mutex);
@@ -839,9 +945,9 @@ IceInternal::LocatorInfo::finishRequest(
         {
             _table->addObjectReference(ref->getIdentity(), proxy->_getReference());
         }
-        else if (notRegistered) // If the well-known object isn't registered anymore, remove it from the cache.
+        else if (notRegistered) // If the well-known object isn't registered anymore, cache it as not registered.
         {
-            _table->removeObjectReference(ref->getIdentity());
+            _table->addObjectNotRegistered(ref->getIdentity());
         }
 
         lock_guard lock(_mutex);
@@ -5,12 +5,14 @@
 
 #include "EndpointIF.h"
 #include "Ice/Identity.h"
+#include "Ice/InstanceF.h"
 #include "Ice/Locator.h"
 #include "Ice/PropertiesF.h"
 #include "Ice/ReferenceF.h"
 #include "LocatorInfoF.h"
 
 #include <condition_variable>
+#include <list>
 #include <mutex>
 
 namespace IceInternal
@@ -30,6 +32,8 @@ namespace IceInternal
 
     private:
         const bool _background;
+        const std::size_t _cacheMaxSize;
+        const std::chrono::milliseconds _notRegisteredTimeout;
 
         using LocatorInfoTable = std::map<Ice::LocatorPrx, LocatorInfoPtr>;
         LocatorInfoTable _table;
@@ -42,24 +46,110 @@ namespace IceInternal
     class LocatorTable final
     {
     public:
-        LocatorTable();
+        // The maximum number of adapters and well-known objects to cache (0 for no limit), and how long to cache the
+        // adapters and well-known objects that are not registered with the locator (0 to not cache them).
+        LocatorTable(std::size_t, std::chrono::milliseconds);
 
         void clear();
 
-        bool getAdapterEndpoints(const std::string&, std::chrono::milliseconds, std::vector<EndpointIPtr>&);
+        // Returns true if the endpoints are cached and not expired. If expired, the endpoints are still returned. If
+        // the adapter is cached as not registered, returns false and sets the last parameter to true.
+        bool getAdapterEndpoints(const std::string&, std::chrono::milliseconds, std::vector<EndpointIPtr>&, bool&);
         void addAdapterEndpoints(const std::string&, const std::vector<EndpointIPtr>&);
+        void addAdapterNotRegistered(const std::string&);
         std::vector<EndpointIPtr> removeAdapterEndpoints(const std::string&);
 
-        bool getObjectReference(const Ice::Identity&, std::chrono::milliseconds, ReferencePtr&);
+        bool getObjectReference(const Ice::Identity&, std::chrono::milliseconds, ReferencePtr&, bool&);
         void addObjectReference(const Ice::Identity&, const ReferencePtr&);
+        void addObjectNotRegistered(const Ice::Identity&);
         ReferencePtr removeObjectReference(const Ice::Identity&);
 
+        // Writes the cache hits and misses to the trace.
+        void traceStatistics(const InstancePtr&, const Ice::LocatorPrx&);
+
     private:
         [[nodiscard]] bool checkTTL(const std::chrono::steady_clock::time_point&, std::chrono::milliseconds) const;
 
-        std::map<std::string, std::pair<std::chrono::steady_clock::time_point, std::vector<EndpointIPtr>>>
-            _adapterEndpointsMap;
-        std::map<Ice::Identity, std::pair<std::chrono::steady_clock::time_point, ReferencePtr>> _objectMap;
+        // A map which evicts its least recently used entry when it reaches its maximum size.
+        template<typename Key, typename Value> class Cache
+        {
+        public:
+            struct Entry
+            {
+                std::chrono::steady_clock::time_point time;
+                Value value;
+                bool notRegistered;
+            };
+
+            Cache(std::size_t maxSize) : _maxSize(maxSize) {}
+
+            // Returns the entry for the given key, or nullptr if there's no entry. The entry becomes the most
+            // recently used entry.
+            Entry* find(const Key& key)
+            {
+                auto p = _entries.find(key);
+                if (p == _entries.end())
+                {
+                    return nullptr;
+                }
+                _lru.splice(_lru.begin(), _lru, p->second.second);
+                return &p->second.first;
+            }
+
+            void put(const Key& key, Value value, bool notRegistered)
+            {
+                Entry entry{std::chrono::steady_clock::now(), std::move(value), notRegistered};
+                auto p = _entries.find(key);
+                if (p != _entries.end())
+                {
+                    p->second.first = std::move(entry);
+                    _lru.splice(_lru.begin(), _lru, p->second.second);
+                    return;
+                }
+
+                if (_maxSize > 0 && _entries.size() >= _maxSize)
+                {
+                    _entries.erase(_lru.back());
+                    _lru.pop_back();
+                }
+                _lru.push_front(key);
+                _entries.emplace(key, std::make_pair(std::move(entry), _lru.begin()));
+            }
+
+            std::optional<Value> remove(const Key& key)
+            {
+                auto p = _entries.find(key);
+                if (p == _entries.end())
+                {
+                    return std::nullopt;
+                }
+                Value value = std::move(p->second.first.value);
+                _lru.erase(p->second.second);
+                _entries.erase(p);
+                return value;
+            }
+
+            void clear()
+            {
+                _entries.clear();
+                _lru.clear();
+            }
+
+        private:
+            const std::size_t _maxSize;
+            std::map<Key, std::pair<Entry, typename std::list<Key>::iterator>> _entries;
+            std::list<Key> _lru; // The most recently used key first.
+        };
+
+        const std::chrono::milliseconds _notRegisteredTimeout;
+        Cache<std::string, std::vector<EndpointIPtr>> _adapterEndpointsMap;
+        Cache<Ice::Identity, ReferencePtr> _objectMap;
+
+        std::uint64_t _hits{0};
+        std::uint64_t _expiredHits{0};
+        std::uint64_t _notRegisteredHits{0};
+        std::uint64_t _misses{0};
+
         std::mutex _mutex;
     };
 
@@ -147,6 +237,7 @@ namespace IceInternal
 
     private:
         void getEndpointsException(const ReferencePtr&, std::exception_ptr);
+        void getEndpointsNotRegistered(const ReferencePtr&, const GetEndpointsCallbackPtr&);
         void getEndpointsTrace(const ReferencePtr&, const std::vector<EndpointIPtr>&, bool);
         void trace(const std::string&, const ReferencePtr&, const std::vector<EndpointIPtr>&);
         void trace(const std::string&, const ReferencePtr&, const ReferencePtr&);
@@ -62,41 +62,49 @@ LoggerMiddleware::dispatch(Ice::IncomingRequest& request, function<void(Outgoing
                 sendResponse(std::move(response));
             });
     }
+    catch (...)
+    {
+        logException(current_exception(), request.current());
+        throw;
+    }
+}
+
+void
+LoggerMiddleware::logException(exception_ptr exception, const Current& current) const noexcept
+{
+    try
+    {
+        rethrow_exception(exception);
+    }
     catch (const UserException&)
     {
         if (_traceLevel > 0)
         {
-            logDispatch(ReplyStatus::UserException, request.current());
+            logDispatch(ReplyStatus::UserException, current);
         }
-        throw;
     }
     catch (const UnknownException& ex)
     {
-        logDispatchFailed(ex, request.current()); // always log when this middleware installed
-        throw;
+        logDispatchFailed(ex, current); // always log when this middleware installed
     }
     catch (const DispatchException& ex)
     {
         if (_traceLevel > 0 || _warningLevel > 1)
         {
-            logDispatchFailed(ex, request.current());
+            logDispatchFailed(ex, current);
         }
-        throw;
     }
     catch (const Ice::LocalException& ex)
     {
-        logDispatchFailed(ex, request.current());
-        throw;
+        logDispatchFailed(ex, current);
     }
     catch (const std::exception& ex)
     {
-        logDispatchFailed(ex.what(), request.current());
-        throw;
+        logDispatchFailed(ex.what(), current);
     }
     catch (...)
     {
-        logDispatchFailed("c++ exception", request.current());
-        throw;
+        logDispatchFailed("c++ exception", current);
     }
 }
 
@@ -24,6 +24,12 @@ namespace IceInternal
 
         void dispatch(Ice::IncomingRequest&, std::function<void(Ice::OutgoingResponse)>) final;
 
+        // Logs an exception thrown by the next object of the dispatch pipeline.
+        void logException(std::exception_ptr, const Ice::Current&) const noexcept;
+
+        [[nodiscard]] const Ice::ObjectPtr& next() const noexcept { return _next; }
+        [[nodiscard]] bool tracesDispatches() const noexcept { return _traceLevel > 0; }
+
     private:
         void logDispatch(Ice::ReplyStatus replyStatus, const Ice::Current& current) const noexcept;
         void logDispatchFailed(std::string_view message, const Ice::Current& current) const noexcept;
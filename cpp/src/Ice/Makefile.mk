@@ -21,6 +21,12 @@ ifeq ($(os),Linux)
 ifeq ($(shell pkg-config --exists libsystemd 2> /dev/null && echo yes),yes)
 Ice_cppflags                            += -DICE_USE_SYSTEMD $(shell pkg-config --cflags libsystemd)
 endif
+ifeq ($(ZSTD)$(shell pkg-config --exists libzstd 2> /dev/null && echo yes),yesyes)
+Ice_cppflags                            += -DICE_HAS_ZSTD $(shell pkg-config --cflags libzstd)
+endif
+ifeq ($(LZ4)$(shell pkg-config --exists liblz4 2> /dev/null && echo yes),yesyes)
+Ice_cppflags                            += -DICE_HAS_LZ4 $(shell pkg-config --cflags liblz4)
+endif
 endif
 
 ios_extrasources :=  $(wildcard $(addprefix $(currentdir)/ios/,*.cpp *.mm))
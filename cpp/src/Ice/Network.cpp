@@ -698,6 +698,22 @@ IceInternal::NativeInfo::completed(SocketOperation operation)
 
 #else
 
+#    if defined(ICE_USE_IO_URING)
+IceInternal::AsyncInfo::AsyncInfo(SocketOperation s) : status(s) {}
+
+AsyncInfo*
+IceInternal::NativeInfo::getAsyncInfo(SocketOperation)
+{
+    return nullptr;
+}
+
+void
+IceInternal::NativeInfo::disableAsyncIO()
+{
+    // Nothing to do
+}
+#    endif
+
 void
 IceInternal::NativeInfo::setNewFd(SOCKET fd)
 {
@@ -45,6 +45,30 @@ typedef int ssize_t;
 #    define ICE_USE_POLL 1
 #endif
 
+//
+// On Linux, the epoll selector can optionally be replaced at runtime by an io_uring based selector. It's enabled
+// with the thread pool IoUring property.
+//
+#if defined(ICE_USE_EPOLL) && !defined(ICE_NO_IO_URING) && defined(__has_include)
+#    if __has_include(<linux/io_uring.h>)
+#        define ICE_USE_IO_URING 1
+#    endif
+#endif
+
+#if defined(ICE_USE_IO_URING)
+#    include <atomic>
+#    include <memory>
+#    include <vector>
+#endif
+
+//
+// On Linux, UDP transceivers can receive and send several datagrams with a single recvmmsg or sendmmsg system call.
+// It's enabled with the Ice.UDP.BatchSize property.
+//
+#if defined(__linux__) && !defined(ICE_NO_MMSG)
+#    define ICE_USE_MMSG 1
+#endif
+
 #if defined(_WIN32) || defined(__osf__)
 typedef int socklen_t;
 #endif
@@ -120,6 +144,34 @@ namespace IceInternal
         DWORD count;
         DWORD error;
     };
+#elif defined(ICE_USE_IO_URING)
+    //
+    // AsyncInfo struct for the io_uring selector holds the buffer and the state of the receive or send request of a
+    // socket. The buffer belongs to the socket rather than to the connection: the selector keeps it alive until the
+    // request completes, which can be after the socket is closed.
+    //
+    struct ICE_API AsyncInfo
+    {
+        enum State
+        {
+            StateIdle,      // There's no request and no received data to read.
+            StateBuffered,  // There's no request, the buffer contains received data not read yet.
+            StateStart,     // The socket asks the selector to submit a request.
+            StatePending,   // The selector submitted the request.
+            StateCompleted, // The request completed, the selector set the result.
+        };
+
+        AsyncInfo(SocketOperation);
+
+        const SocketOperation status;
+        std::atomic<bool> enabled{false}; // Set by the selector if it supports the requests of this socket.
+        std::atomic<int> state{StateIdle};
+        std::shared_ptr<std::vector<std::byte>> buf;
+        std::size_t begin{0};                 // The first received byte not read yet.
+        std::size_t end{0};                   // The end of the received bytes, or the number of bytes to send.
+        const std::byte* origin{nullptr};     // The data of the caller's buffer copied to the send buffer.
+        int result{0};                        // The number of bytes received or sent, or minus the error code.
+    };
 #endif
 
     class ICE_API ReadyCallback
@@ -165,6 +217,15 @@ namespace IceInternal
 #else
         bool newFd();
         void setNewFd(SOCKET);
+#    if defined(ICE_USE_IO_URING)
+        // Returns the async info of the given operation if the io_uring selector can submit receive or send requests
+        // for this socket, nullptr otherwise. The selector submits poll requests for the other sockets.
+        virtual AsyncInfo* getAsyncInfo(SocketOperation);
+
+        // Disables the receive and send requests. It must be called by the transceivers that read or write the socket
+        // directly, before the socket is registered with the selector.
+        virtual void disableAsyncIO();
+#    endif
 #endif
 
     protected:
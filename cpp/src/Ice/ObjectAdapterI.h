@@ -91,6 +91,10 @@ namespace Ice
         void decDirectCount();
 
         [[nodiscard]] IceInternal::ThreadPoolPtr getThreadPool() const;
+        [[nodiscard]] const IceInternal::ServantManagerPtr& getServantManager() const noexcept
+        {
+            return _servantManager;
+        }
         void setAdapterOnConnection(const ConnectionIPtr&);
         [[nodiscard]] size_t messageSizeMax() const { return _messageSizeMax; }
 
@@ -11,6 +11,7 @@
 #include "Instance.h"
 #include "LocatorInfo.h"
 #include "ObjectAdapterFactory.h"
+#include "Protocol.h"
 #include "Reference.h"
 #include "RequestHandlerCache.h"
 #include "RetryQueue.h"
@@ -888,85 +889,8 @@ OutgoingAsync::response()
                 _observer.userException();
                 break;
 
-            case ReplyStatus::ObjectNotExist:
-            case ReplyStatus::FacetNotExist:
-            case ReplyStatus::OperationNotExist:
-            {
-                Identity ident;
-                _is.read(ident);
-
-                //
-                // For compatibility with the old FacetPath.
-                //
-                vector<string> facetPath;
-                _is.read(facetPath);
-                string facet;
-                if (!facetPath.empty())
-                {
-                    if (facetPath.size() > 1)
-                    {
-                        throw MarshalException{__FILE__, __LINE__, "received facet path with more than one element"};
-                    }
-                    facet.swap(facetPath[0]);
-                }
-
-                string operation;
-                _is.read(operation, false);
-                switch (replyStatus)
-                {
-                    case ReplyStatus::ObjectNotExist:
-                        throw ObjectNotExistException{
-                            __FILE__,
-                            __LINE__,
-                            std::move(ident),
-                            std::move(facet),
-                            std::move(operation)};
-                        break;
-
-                    case ReplyStatus::FacetNotExist:
-                        throw FacetNotExistException{
-                            __FILE__,
-                            __LINE__,
-                            std::move(ident),
-                            std::move(facet),
-                            std::move(operation)};
-                        break;
-
-                    default:
-                        throw OperationNotExistException{
-                            __FILE__,
-                            __LINE__,
-                            std::move(ident),
-                            std::move(facet),
-                            std::move(operation)};
-                        break;
-                }
-                break;
-            }
-
             default:
-            {
-                string message;
-                _is.read(message, false);
-
-                switch (replyStatus)
-                {
-                    case ReplyStatus::UnknownException:
-                        throw UnknownException{__FILE__, __LINE__, std::move(message)};
-                        break;
-
-                    case ReplyStatus::UnknownLocalException:
-                        throw UnknownLocalException{__FILE__, __LINE__, std::move(message)};
-                        break;
-
-                    case ReplyStatus::UnknownUserException:
-                        throw UnknownUserException{__FILE__, __LINE__, std::move(message)};
-                        break;
-
-                    default:
-                        throw DispatchException{__FILE__, __LINE__, replyStatus, std::move(message)};
-                }
-            }
+                throwReplyStatusException(replyStatus, _is);
         }
 
         return responseImpl(replyStatus == ReplyStatus::Ok, true);
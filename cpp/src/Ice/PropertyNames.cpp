@@ -56,6 +56,8 @@ const Property ThreadPoolPropsData[] =
     Property{"SizeMax", "", false, false, nullptr},
     Property{"SizeWarn", "0", false, false, nullptr},
     Property{"Serialize", "0", false, false, nullptr},
+    Property{"IoUring", "0", false, false, nullptr},
+    Property{"Shards", "1", false, false, nullptr},
     Property{"ThreadIdleTime", "60", false, false, nullptr}
 };
 
@@ -65,7 +67,7 @@ const PropertyArray PropertyNames::ThreadPoolProps
     .prefixOnly=true,
     .isOptIn=false,
     .properties=ThreadPoolPropsData,
-    .length=5
+    .length=7
 };
 
 const Property ObjectAdapterPropsData[] =
@@ -124,6 +126,7 @@ const Property IcePropsData[] =
     Property{"BatchAutoFlush", "", false, true, nullptr},
     Property{"BatchAutoFlushSize", "1024", false, false, nullptr},
     Property{"ClassGraphDepthMax", "10", false, false, nullptr},
+    Property{"Compression.Codec", "bzip2", false, false, nullptr},
     Property{"Compression.Level", "1", false, false, nullptr},
     Property{"Config", "", false, false, nullptr},
     Property{"Connection.Client", "", false, false, &PropertyNames::ConnectionProps},
@@ -141,12 +144,17 @@ const Property IcePropsData[] =
     Property{"Default.SlicedFormat", "0", false, false, nullptr},
     Property{"Default.SourceAddress", "", false, false, nullptr},
     Property{"EventLog.Source", "", false, false, nullptr},
+    Property{"HostResolver.CacheMaxSize", "1000", false, false, nullptr},
+    Property{"HostResolver.CacheTimeout", "0", false, false, nullptr},
+    Property{"HostResolver.Size", "1", false, false, nullptr},
     Property{"HTTPProxyHost", "", false, false, nullptr},
     Property{"HTTPProxyPort", "1080", false, false, nullptr},
     Property{"ImplicitContext", "None", false, false, nullptr},
     Property{"InitPlugins", "1", false, false, nullptr},
     Property{"IPv4", "1", false, false, nullptr},
     Property{"IPv6", "1", false, false, nullptr},
+    Property{"LocatorCache.MaxSize", "0", false, false, nullptr},
+    Property{"LocatorCache.NotRegisteredTimeout", "0", false, false, nullptr},
     Property{"LogFile", "", false, false, nullptr},
     Property{"LogFile.SizeMax", "0", false, false, nullptr},
     Property{"LogStdErr.Convert", "1", false, false, nullptr},
@@ -180,6 +188,7 @@ const Property IcePropsData[] =
     Property{"Trace.Retry", "0", false, false, nullptr},
     Property{"Trace.Slicing", "0", false, false, nullptr},
     Property{"Trace.ThreadPool", "0", false, false, nullptr},
+    Property{"UDP.BatchSize", "1", false, false, nullptr},
     Property{"UDP.RcvSize", "", false, false, nullptr},
     Property{"UDP.SndSize", "", false, false, nullptr},
     Property{"TCP.Backlog", "511", false, false, nullptr},
@@ -203,7 +212,7 @@ const PropertyArray PropertyNames::IceProps
     .prefixOnly=false,
     .isOptIn=false,
     .properties=IcePropsData,
-    .length=85
+    .length=92
 };
 
 const Property IceMXPropsData[] =
@@ -433,6 +442,7 @@ const Property IceSSLPropsData[] =
     Property{"CertificateRevocationListFiles", "", false, false, nullptr},
     Property{"DefaultDir", "", false, false, nullptr},
     Property{"FindCert", "", false, false, nullptr},
+    Property{"KernelTLS", "0", false, false, nullptr},
     Property{"KeyFile", "", false, false, nullptr},
     Property{"Keychain", "", false, false, nullptr},
     Property{"KeychainPassword", "", false, false, nullptr},
@@ -454,7 +464,7 @@ const PropertyArray PropertyNames::IceSSLProps
     .prefixOnly=false,
     .isOptIn=false,
     .properties=IceSSLPropsData,
-    .length=21
+    .length=22
 };
 
 const Property IceStormPropsData[] =
@@ -463,6 +473,9 @@ const Property IceStormPropsData[] =
     Property{"Election.ElectionTimeout", "10", false, false, nullptr},
     Property{"Election.MasterTimeout", "10", false, false, nullptr},
     Property{"Election.ResponseTimeout", "10", false, false, nullptr},
+    Property{"EventLog.RetentionSize", "0", false, false, nullptr},
+    Property{"EventLog.RetentionTime", "0", false, false, nullptr},
+    Property{"EventLog.Topics", "", false, false, nullptr},
     Property{"Flush.Timeout", "1000", false, false, nullptr},
     Property{"InstanceName", "IceStorm", false, false, nullptr},
     Property{"LMDB", "", false, false, &PropertyNames::LMDBProps},
@@ -474,6 +487,7 @@ const Property IceStormPropsData[] =
     Property{"ReplicatedTopicManagerEndpoints", "", false, false, nullptr},
     Property{"Send.QueueSizeMax", "-1", false, false, nullptr},
     Property{"Send.QueueSizeMaxPolicy", "", false, false, nullptr},
+    Property{"Send.Threads", "0", false, false, nullptr},
     Property{"Send.Timeout", "60000", false, false, nullptr},
     Property{"TopicManager.Proxy", "", false, false, &PropertyNames::ProxyProps},
     Property{"TopicManager", "", false, false, &PropertyNames::ObjectAdapterProps},
@@ -491,7 +505,7 @@ const PropertyArray PropertyNames::IceStormProps
     .prefixOnly=false,
     .isOptIn=true,
     .properties=IceStormPropsData,
-    .length=24
+    .length=28
 };
 
 const Property IceStormAdminPropsData[] =
@@ -529,6 +543,8 @@ const Property Glacier2PropsData[] =
 {
     Property{"AddConnectionContext", "0", false, false, nullptr},
     Property{"Client", "", false, false, &PropertyNames::ObjectAdapterProps},
+    Property{"Client.Batch.FlushInterval", "0", false, false, nullptr},
+    Property{"Client.Batch.MaxSize", "65536", false, false, nullptr},
     Property{"Client.ForwardContext", "0", false, false, nullptr},
     Property{"Client.Trace.Reject", "0", false, false, nullptr},
     Property{"Client.Trace.Request", "0", false, false, nullptr},
@@ -559,7 +575,7 @@ const PropertyArray PropertyNames::Glacier2Props
     .prefixOnly=false,
     .isOptIn=true,
     .properties=Glacier2PropsData,
-    .length=24
+    .length=26
 };
 
 const Property DataStormPropsData[] =
@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Protocol.h"
+#include "Ice/InputStream.h"
 #include "Ice/LocalExceptions.h"
 
 using namespace std;
@@ -69,3 +70,83 @@ namespace IceInternal
         byte{0} // Message size (placeholder)
     };
 }
+
+void
+IceInternal::throwReplyStatusException(ReplyStatus replyStatus, InputStream& is)
+{
+    switch (replyStatus)
+    {
+        case ReplyStatus::ObjectNotExist:
+        case ReplyStatus::FacetNotExist:
+        case ReplyStatus::OperationNotExist:
+        {
+            Identity ident;
+            is.read(ident);
+
+            //
+            // For compatibility with the old FacetPath.
+            //
+            vector<string> facetPath;
+            is.read(facetPath);
+            string facet;
+            if (!facetPath.empty())
+            {
+                if (facetPath.size() > 1)
+                {
+                    throw MarshalException{__FILE__, __LINE__, "received facet path with more than one element"};
+                }
+                facet.swap(facetPath[0]);
+            }
+
+            string operation;
+            is.read(operation, false);
+            switch (replyStatus)
+            {
+                case ReplyStatus::ObjectNotExist:
+                    throw ObjectNotExistException{
+                        __FILE__,
+                        __LINE__,
+                        std::move(ident),
+                        std::move(facet),
+                        std::move(operation)};
+
+                case ReplyStatus::FacetNotExist:
+                    throw FacetNotExistException{
+                        __FILE__,
+                        __LINE__,
+                        std::move(ident),
+                        std::move(facet),
+                        std::move(operation)};
+
+                default:
+                    throw OperationNotExistException{
+                        __FILE__,
+                        __LINE__,
+                        std::move(ident),
+                        std::move(facet),
+                        std::move(operation)};
+            }
+        }
+
+        default:
+        {
+            string message;
+            is.read(message, false);
+
+            switch (replyStatus)
+            {
+                case ReplyStatus::UnknownException:
+                    throw UnknownException{__FILE__, __LINE__, std::move(message)};
+
+                case ReplyStatus::UnknownLocalException:
+                    throw UnknownLocalException{__FILE__, __LINE__, std::move(message)};
+
+                case ReplyStatus::UnknownUserException:
+                    throw UnknownUserException{__FILE__, __LINE__, std::move(message)};
+
+                default:
+                    throw DispatchException{__FILE__, __LINE__, replyStatus, std::move(message)};
+            }
+        }
+    }
+}
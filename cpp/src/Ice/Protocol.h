@@ -5,8 +5,14 @@
 
 #include "Ice/Config.h"
 #include "Ice/LocalExceptions.h"
+#include "Ice/ReplyStatus.h"
 #include "Ice/VersionFunctions.h"
 
+namespace Ice
+{
+    class InputStream;
+}
+
 namespace IceInternal
 {
     //
@@ -79,6 +85,12 @@ namespace IceInternal
                 "this Ice runtime does not support encoding version " + Ice::encodingVersionToString(v)};
         }
     }
+
+    //
+    // Reads the remainder of a reply with a reply status other than Ok and UserException, and throws the
+    // corresponding exception.
+    //
+    [[noreturn]] void throwReplyStatusException(Ice::ReplyStatus, Ice::InputStream&);
 }
 
 #endif
@@ -5,12 +5,16 @@
 
 #include "CollocatedRequestHandler.h"
 #include "ConnectionI.h"
+#include "ForwardAsync.h"
+#include "Ice/AsyncResponseHandler.h"
 #include "Ice/InputStream.h"
 #include "Ice/OutgoingAsync.h"
 #include "Ice/OutputStream.h"
 #include "Ice/Proxy.h"
 #include "ReferenceFactory.h"
 
+#include <cstring>
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -213,6 +217,37 @@ namespace IceInternal
             return false;
         }
     };
+
+    //
+    // Class for forwarding an incoming request, see forwardAsync.
+    //
+    class ForwardOutgoingAsync final : public OutgoingAsync, public LambdaInvoke
+    {
+    public:
+        ForwardOutgoingAsync(Ice::ObjectPrx proxy, std::shared_ptr<AsyncResponseHandler> responseHandler)
+            : OutgoingAsync(std::move(proxy), false),
+              LambdaInvoke([responseHandler](std::exception_ptr ex) { responseHandler->sendException(ex); }, nullptr),
+              _responseHandler(std::move(responseHandler))
+        {
+            if (_proxy._getReference()->isTwoway())
+            {
+                _response = [this](bool ok) { _responseHandler->sendResponse(makeResponse(ok)); };
+            }
+            else
+            {
+                // The dispatch of a oneway request completes once the request has been forwarded (sent).
+                LambdaInvoke::_sent = [responseHandler = _responseHandler](bool)
+                { responseHandler->sendEmptyResponse(); };
+            }
+        }
+
+        void invoke(Ice::IncomingRequest&, const Ice::Context&);
+
+    private:
+        Ice::OutgoingResponse makeResponse(bool);
+
+        const std::shared_ptr<AsyncResponseHandler> _responseHandler;
+    };
 }
 
 ProxyFlushBatchAsync::ProxyFlushBatchAsync(ObjectPrx proxy) : ProxyOutgoingAsyncBase(std::move(proxy)) {}
@@ -599,6 +634,117 @@ Ice::ObjectPrx::ice_invokeAsync(
     return [outAsync]() { outAsync->cancel(); };
 }
 
+void
+ForwardOutgoingAsync::invoke(IncomingRequest& request, const Context& context)
+{
+    const Current& current = _responseHandler->current();
+    try
+    {
+        prepare(current.operation, current.mode, context);
+
+        InputStream& is = request.inputStream();
+        const byte* encaps;
+        int32_t sz;
+        is.readEncapsulation(encaps, sz);
+
+        //
+        // If the encapsulation is the end of the received message and the header of the forwarded request fits in
+        // the header of the received request, which was read already, we write the header of the forwarded request
+        // just before the encapsulation and send the request from the received message. The message memory must not
+        // be shared yet, as someone else could still read it.
+        //
+        size_t hdrSize = _os.b.size();
+        bool spliced = false;
+        if (!_proxy._getReference()->isBatch() && request.requestCount() == 1 && encaps + sz == is.b.end() &&
+            static_cast<size_t>(encaps - is.b.begin()) >= hdrSize && !is.b.sharesMemory())
+        {
+            shared_ptr<const byte> owner = is.b.share();
+            if (owner)
+            {
+                auto begin = const_cast<byte*>(encaps) - hdrSize;
+                memcpy(begin, _os.b.begin(), hdrSize);
+                _os.b = Buffer::Container{std::move(owner), begin, const_cast<byte*>(encaps) + sz};
+                spliced = true;
+            }
+        }
+
+        if (!spliced)
+        {
+            _os.writeEncapsulation(encaps, sz);
+        }
+        OutgoingAsync::invoke(current.operation);
+
+        if (_proxy._getReference()->isBatch())
+        {
+            // The request is queued in the batch of the proxy, there's no sent or response callback.
+            _responseHandler->sendEmptyResponse();
+        }
+    }
+    catch (const std::exception&)
+    {
+        abort(std::current_exception());
+    }
+}
+
+OutgoingResponse
+ForwardOutgoingAsync::makeResponse(bool ok)
+{
+    const Current& current = _responseHandler->current();
+    if (current.requestId == 0)
+    {
+        // The request was received as a oneway request and forwarded as a twoway request.
+        return makeEmptyOutgoingResponse(current);
+    }
+
+    if (_is.b.empty())
+    {
+        return makeOutgoingResponse(ok, {nullptr, nullptr}, current);
+    }
+
+    try
+    {
+        //
+        // response() read the reply status. If the reply message only holds the encapsulation after the reply status,
+        // we write the header and request ID of the response in place of the header and request ID of the reply, and
+        // send the response from the reply message.
+        //
+        const byte* encaps;
+        int32_t sz;
+        _is.readEncapsulation(encaps, sz);
+        if (encaps == _is.b.begin() + headerSize + sizeof(int32_t) + 1 && encaps + sz == _is.b.end() &&
+            !_is.b.sharesMemory())
+        {
+            shared_ptr<const byte> owner = _is.b.share();
+            if (owner)
+            {
+                OutputStream ostr{current.adapter->getCommunicator(), Ice::currentProtocolEncoding};
+                ostr.b = Buffer::Container{std::move(owner), _is.b.begin(), _is.b.end()};
+                memcpy(ostr.b.begin(), replyHdr, sizeof(replyHdr));
+                ostr.rewrite(current.requestId, headerSize);
+                ReplyStatus replyStatus = ok ? ReplyStatus::Ok : ReplyStatus::UserException;
+                ostr.b[headerSize + sizeof(int32_t)] = static_cast<byte>(replyStatus);
+                return OutgoingResponse{std::move(ostr), current};
+            }
+        }
+        return makeOutgoingResponse(ok, {encaps, encaps + sz}, current);
+    }
+    catch (...)
+    {
+        return makeOutgoingResponse(current_exception(), current);
+    }
+}
+
+void
+IceInternal::forwardAsync(
+    const ObjectPrx& proxy,
+    IncomingRequest& request,
+    function<void(OutgoingResponse)> sendResponse,
+    const Context& context)
+{
+    auto responseHandler = make_shared<AsyncResponseHandler>(std::move(sendResponse), request.current());
+    make_shared<ForwardOutgoingAsync>(proxy, responseHandler)->invoke(request, context);
+}
+
 Ice::ConnectionPtr
 Ice::ObjectPrx::ice_getConnection() const
 {
@@ -44,6 +44,17 @@ RequestHandlerCache::getRequestHandler()
     }
 }
 
+RequestHandlerPtr
+RequestHandlerCache::getCachedRequestHandler()
+{
+    if (_cacheConnection)
+    {
+        lock_guard<mutex> lock(_mutex);
+        return _cachedRequestHandler;
+    }
+    return nullptr;
+}
+
 ConnectionPtr
 RequestHandlerCache::getCachedConnection()
 {
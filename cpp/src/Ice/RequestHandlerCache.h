@@ -18,6 +18,10 @@ namespace IceInternal
 
         RequestHandlerPtr getRequestHandler();
 
+        // Returns the cached request handler, without creating one. Returns nullptr if there's no cached request
+        // handler.
+        RequestHandlerPtr getCachedRequestHandler();
+
         Ice::ConnectionPtr getCachedConnection();
 
         void clearCachedRequestHandler(const RequestHandlerPtr& handler);
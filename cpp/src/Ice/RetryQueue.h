@@ -9,6 +9,7 @@
 #include "Timer.h"
 
 #include <mutex>
+#include <set>
 
 namespace IceInternal
 {
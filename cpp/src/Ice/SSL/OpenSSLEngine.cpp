@@ -362,6 +362,19 @@ OpenSSL::SSLEngine::initialize()
 
         SSL_CTX_set_mode(_ctx, SSL_MODE_ENABLE_PARTIAL_WRITE);
 
+        if (properties->getIcePropertyAsInt("IceSSL.KernelTLS") > 0)
+        {
+#if defined(SSL_OP_ENABLE_KTLS)
+            // Once the handshake completes, OpenSSL hands the session keys over to the kernel TLS module for the
+            // socket, if the negotiated cipher is supported. Records are then encrypted and decrypted by the kernel,
+            // or by the NIC if it supports TLS offload. OpenSSL silently falls back to user space encryption otherwise.
+            SSL_CTX_set_options(_ctx, SSL_OP_ENABLE_KTLS);
+#else
+            Warning out(getLogger());
+            out << "IceSSL.KernelTLS is ignored: this version of OpenSSL doesn't support kernel TLS";
+#endif
+        }
+
         // Store a pointer to ourself for use in OpenSSL callbacks.
         SSL_CTX_set_ex_data(_ctx, 0, this);
 
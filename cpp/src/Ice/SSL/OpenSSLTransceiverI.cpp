@@ -80,6 +80,11 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         }
         else
         {
+#if defined(ICE_USE_IO_URING)
+            // OpenSSL reads and writes the socket directly, the selector must not read or write it with io_uring
+            // requests.
+            _delegate->getNativeInfo()->disableAsyncIO();
+#endif
             bio = BIO_new_socket(fd, 0);
         }
 
@@ -260,6 +265,13 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
             out << "bits = " << SSL_CIPHER_get_bits(cipher, nullptr) << "\n";
             out << "protocol = " << SSL_get_version(_ssl) << "\n";
         }
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+        if (SSL_get_options(_ssl) & SSL_OP_ENABLE_KTLS)
+        {
+            out << "kernel TLS = " << (BIO_get_ktls_send(SSL_get_wbio(_ssl)) ? "send" : "no send") << ", "
+                << (BIO_get_ktls_recv(SSL_get_rbio(_ssl)) ? "recv" : "no recv") << "\n";
+        }
+#endif
         out << toString();
     }
 
@@ -5,13 +5,16 @@
 #include "Ice/LocalExceptions.h"
 #include "Ice/LoggerUtil.h"
 #include "Instance.h"
+#include "TraceLevels.h"
 
 #ifdef ICE_USE_CFSTREAM
 #    include <CoreFoundation/CFStream.h>
 #    include <CoreFoundation/CoreFoundation.h>
 #endif
 
+#include <algorithm>
 #include <chrono>
+#include <limits>
 #include <thread>
 
 using namespace std;
@@ -22,6 +25,13 @@ namespace
 {
     struct timespec zeroTimeout = {0, 0};
 }
+#elif defined(ICE_USE_IO_URING)
+namespace
+{
+    // The user data of the interrupt pipe poll request and of the cancel requests.
+    const uint64_t ioUringInterruptId = 0;
+    const uint64_t ioUringCancelId = numeric_limits<uint64_t>::max();
+}
 #endif
 
 #if defined(ICE_USE_IOCP)
@@ -221,9 +231,40 @@ Selector::Selector(InstancePtr instance) : _instance(std::move(instance))
 #    endif
 }
 
+#    if defined(ICE_USE_IO_URING)
+void
+Selector::setupIoUring(const string& prefix)
+{
+    assert(!_ioUring && _ioUringHandlers.empty());
+    if (!_ring.setup(static_cast<unsigned int>(_events.size())))
+    {
+        Ice::Warning out(_instance->initializationData().logger);
+        out << "unable to setup io_uring, the selector will use epoll instead:\n"
+            << IceInternal::errorToString(IceInternal::getSocketErrno());
+        return;
+    }
+    _ioUring = true;
+    _ioUringPrefix = prefix;
+    _ring.pollAdd(_fdIntrRead, POLLIN, ioUringInterruptId);
+}
+#    endif
+
 void
 Selector::destroy()
 {
+#    if defined(ICE_USE_IO_URING)
+    if (_ioUring && _instance->traceLevels()->threadPool >= 1)
+    {
+        IoUring::Statistics statistics = _ring.getStatistics();
+        Ice::Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+        out << "io_uring statistics for `" << _ioUringPrefix << "':";
+        out << "\nio_uring_enter calls = " << statistics.enterCalls;
+        out << "\nselect calls = " << statistics.waitCalls;
+        out << "\nsubmitted requests = " << statistics.submitted;
+        out << "\ncompleted requests = " << statistics.completed;
+    }
+    _ring.close();
+#    endif
 #    if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
     try
     {
@@ -294,6 +335,13 @@ Selector::enable(EventHandler* handler, SocketOperation status)
 
     if (handler->_registered & status)
     {
+#    if defined(ICE_USE_IO_URING)
+        if (_ioUring)
+        {
+            updateIoUring(handler);
+            return;
+        }
+#    endif
 #    if defined(ICE_USE_EPOLL)
         SOCKET fd = nativeInfo->fd();
         auto previous = static_cast<SocketOperation>(handler->_registered & ~(handler->_disabled | status));
@@ -349,6 +397,13 @@ Selector::disable(EventHandler* handler, SocketOperation status)
 
     if (handler->_registered & status)
     {
+#    if defined(ICE_USE_IO_URING)
+        if (_ioUring)
+        {
+            updateIoUring(handler);
+            return;
+        }
+#    endif
 #    if defined(ICE_USE_EPOLL)
         SOCKET fd = nativeInfo->fd();
         auto newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
@@ -396,6 +451,23 @@ Selector::finish(EventHandler* handler, bool closeNow)
 #    endif
     }
 
+#    if defined(ICE_USE_IO_URING)
+    auto p = _ioUringHandlers.find(handler);
+    if (p != _ioUringHandlers.end())
+    {
+        // Cancel the requests, including the receive and send requests. The selector keeps their buffers alive
+        // until their completion, the socket can be closed now.
+        cancelIoUringRequest(p->second.read);
+        cancelIoUringRequest(p->second.write);
+        _ioUringHandlers.erase(p);
+        _ioUringChecks.erase(handler);
+        if (_selecting)
+        {
+            _ring.submit();
+        }
+    }
+#    endif
+
 #    if defined(ICE_USE_KQUEUE)
     if (closeNow && !_changes.empty())
     {
@@ -496,13 +568,42 @@ Selector::startSelect()
         updateSelector();
     }
 #    endif
-    _selecting = true;
 
     //
     // If there are ready handlers, don't block in select, just do a non-blocking
     // select to retrieve new ready handlers from the Java selector.
     //
     _selectNow = !_readyHandlers.empty();
+
+#    if defined(ICE_USE_IO_URING)
+    if (_ioUring)
+    {
+        //
+        // Queue the receive and send requests started by the sockets since the last select, they are submitted with
+        // the select system call. Don't block in select if some completions or received data are not reported yet.
+        //
+        for (auto p = _ioUringChecks.begin(); p != _ioUringChecks.end();)
+        {
+            auto q = _ioUringHandlers.find(*p);
+            assert(q != _ioUringHandlers.end());
+            updateIoUring(*p);
+            if (ioUringReady(*p, q->second))
+            {
+                _selectNow = true;
+            }
+
+            if (checkIoUring(q->second))
+            {
+                ++p;
+            }
+            else
+            {
+                p = _ioUringChecks.erase(p);
+            }
+        }
+    }
+#    endif
+    _selecting = true;
 }
 
 void
@@ -519,6 +620,38 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation>>& handlers)
     }
 #    endif
 
+#    if defined(ICE_USE_IO_URING)
+    if (_ioUring)
+    {
+        for (int i = 0; i < _count; ++i)
+        {
+            ioUringCompleted(_completions[static_cast<size_t>(i)]);
+        }
+        _count = 0;
+
+        // Report each handler once, with the operations of its completed requests and its received data not read yet.
+        for (EventHandler* handler : _ioUringChecks)
+        {
+            auto p = _ioUringHandlers.find(handler);
+            assert(p != _ioUringHandlers.end());
+            SocketOperation status = ioUringReady(handler, p->second);
+            if (status)
+            {
+                p->second.completed = static_cast<SocketOperation>(p->second.completed & ~status);
+                auto q = _readyHandlers.find(handler->shared_from_this());
+                if (q != _readyHandlers.end()) // Handler will be added by the loop below
+                {
+                    q->second = static_cast<SocketOperation>(q->second | status);
+                }
+                else
+                {
+                    handlers.emplace_back(handler, status);
+                }
+            }
+        }
+    }
+#    endif
+
 #    if defined(ICE_USE_POLL)
     for (vector<struct pollfd>::const_iterator r = _pollFdSet.begin(); r != _pollFdSet.end(); ++r)
 #    else
@@ -528,7 +661,7 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation>>& handlers)
         pair<EventHandler*, SocketOperation> p;
 
 #    if defined(ICE_USE_EPOLL)
-        struct epoll_event& ev = _events[i];
+        struct epoll_event& ev = _events[static_cast<size_t>(i)];
         p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
         p.second = static_cast<SocketOperation>(
             ((ev.events & (EPOLLIN | EPOLLERR)) ? SocketOperationRead : SocketOperationNone) |
@@ -622,7 +755,16 @@ Selector::select(int timeout)
     while (true)
     {
 #    if defined(ICE_USE_EPOLL)
-        _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+#        if defined(ICE_USE_IO_URING)
+        if (_ioUring)
+        {
+            _count = _ring.wait(_completions, timeout);
+        }
+        else
+#        endif
+        {
+            _count = epoll_wait(_queueFd, &_events[0], static_cast<int>(_events.size()), timeout);
+        }
 #    elif defined(ICE_USE_KQUEUE)
         assert(!_events.empty());
         if (timeout >= 0)
@@ -787,6 +929,14 @@ Selector::updateSelectorForEventHandler(
     [[maybe_unused]] SocketOperation add)
 {
 #    if defined(ICE_USE_EPOLL)
+#        if defined(ICE_USE_IO_URING)
+    if (_ioUring)
+    {
+        updateIoUring(handler);
+        checkReady(handler);
+        return;
+    }
+#        endif
     SocketOperation previous = handler->_registered;
     previous = static_cast<SocketOperation>(previous & ~add);
     previous = static_cast<SocketOperation>(previous | remove);
@@ -883,6 +1033,200 @@ Selector::updateSelectorForEventHandler(
     checkReady(handler);
 }
 
+#    if defined(ICE_USE_IO_URING)
+void
+Selector::updateIoUring(EventHandler* handler)
+{
+    NativeInfoPtr nativeInfo = handler->getNativeInfo();
+    SOCKET fd = nativeInfo ? nativeInfo->fd() : INVALID_SOCKET;
+
+    auto p = _ioUringHandlers.find(handler);
+    if (p == _ioUringHandlers.end())
+    {
+        if (fd == INVALID_SOCKET || !handler->_registered)
+        {
+            return;
+        }
+        p = _ioUringHandlers.insert(make_pair(handler, IoUringHandler{fd, 0, 0, SocketOperationNone, nullptr, nullptr}))
+                .first;
+    }
+
+    IoUringHandler& h = p->second;
+    if (h.fd != fd)
+    {
+        // The handler uses a new socket, cancel the requests of the previous socket.
+        cancelIoUringRequest(h.read);
+        cancelIoUringRequest(h.write);
+        h = IoUringHandler{fd, 0, 0, SocketOperationNone, nullptr, nullptr};
+    }
+
+    if (fd != INVALID_SOCKET)
+    {
+        // The socket provides the async infos once it's connected. It switches to receive or send requests the next
+        // time the operation would block.
+        h.readInfo = nativeInfo->getAsyncInfo(SocketOperationRead);
+        h.writeInfo = nativeInfo->getAsyncInfo(SocketOperationWrite);
+        for (AsyncInfo* info : {h.readInfo, h.writeInfo})
+        {
+            if (info && !info->enabled.load(memory_order_relaxed))
+            {
+                info->enabled.store(true, memory_order_release);
+            }
+        }
+        updateIoUringRequest(handler, h, SocketOperationRead);
+        updateIoUringRequest(handler, h, SocketOperationWrite);
+    }
+
+    if (checkIoUring(h))
+    {
+        _ioUringChecks.insert(handler);
+    }
+
+    if (_selecting)
+    {
+        // The selecting thread is waiting for completions. Submit the new requests now rather than waking up the
+        // selecting thread, unless the handler can be reported right away.
+        _ring.submit();
+        if (ioUringReady(handler, h))
+        {
+            wakeup();
+        }
+    }
+}
+
+void
+Selector::updateIoUringRequest(EventHandler* handler, IoUringHandler& h, SocketOperation operation)
+{
+    uint64_t& id = operation == SocketOperationRead ? h.read : h.write;
+    AsyncInfo* info = operation == SocketOperationRead ? h.readInfo : h.writeInfo;
+    int state = info ? info->state.load(memory_order_acquire) : AsyncInfo::StateIdle;
+
+    //
+    // The receive and send requests are submitted when the socket asks for them. Otherwise, a poll request is
+    // required to report the operation, unless the socket has received data or a completed request to report.
+    //
+    bool async = (handler->_registered & operation) && state == AsyncInfo::StateStart;
+    bool poll = (handler->_registered & operation) && state == AsyncInfo::StateIdle && !(h.completed & operation);
+
+    if (id)
+    {
+        auto p = _ioUringRequests.find(id);
+        assert(p != _ioUringRequests.end());
+        if (p->second.info || poll)
+        {
+            // Receive and send requests are only canceled when the handler is finished. Poll requests are kept
+            // while the operation is disabled, their completion is reported once the operation is enabled.
+            return;
+        }
+        cancelIoUringRequest(id);
+    }
+
+    if (async)
+    {
+        id = _nextRequestId++;
+        _ioUringRequests.insert(make_pair(id, IoUringRequest{handler, operation, info, info->buf}));
+        info->state.store(AsyncInfo::StatePending, memory_order_relaxed);
+        if (operation == SocketOperationRead)
+        {
+            _ring.recv(h.fd, info->buf->data(), info->buf->size(), id);
+        }
+        else
+        {
+            _ring.send(h.fd, info->buf->data(), info->end, id);
+        }
+    }
+    else if (poll && !(handler->_disabled & operation))
+    {
+        id = _nextRequestId++;
+        _ioUringRequests.insert(make_pair(id, IoUringRequest{handler, operation, nullptr, nullptr}));
+        _ring.pollAdd(h.fd, operation == SocketOperationRead ? POLLIN : POLLOUT, id);
+    }
+}
+
+void
+Selector::cancelIoUringRequest(uint64_t& id)
+{
+    if (id)
+    {
+        // The request is removed once its completion is returned, its completion is ignored.
+        auto p = _ioUringRequests.find(id);
+        assert(p != _ioUringRequests.end());
+        p->second.handler = nullptr;
+        _ring.cancel(id, ioUringCancelId);
+        id = 0;
+    }
+}
+
+bool
+Selector::checkIoUring(const IoUringHandler& h) const
+{
+    // The handler must be checked by each select call while it has completions to report or received data to read.
+    // The socket can also start a new request once the handler is reported, the handler is checked by the next select
+    // call before it's removed.
+    auto check = [](AsyncInfo* info)
+    {
+        int state = info ? info->state.load(memory_order_acquire) : AsyncInfo::StateIdle;
+        return state == AsyncInfo::StateBuffered || state == AsyncInfo::StateCompleted;
+    };
+    return h.completed || check(h.readInfo) || check(h.writeInfo);
+}
+
+SocketOperation
+Selector::ioUringReady(EventHandler* handler, const IoUringHandler& h) const
+{
+    auto status = h.completed;
+    if (h.readInfo)
+    {
+        int state = h.readInfo->state.load(memory_order_acquire);
+        if (state == AsyncInfo::StateBuffered || state == AsyncInfo::StateCompleted)
+        {
+            status = static_cast<SocketOperation>(status | SocketOperationRead);
+        }
+    }
+    return static_cast<SocketOperation>(status & handler->_registered & ~handler->_disabled);
+}
+
+void
+Selector::ioUringCompleted(const IoUring::Completion& completion)
+{
+    if (completion.userData == ioUringCancelId)
+    {
+        return;
+    }
+    else if (completion.userData == ioUringInterruptId)
+    {
+        // The interrupt pipe is drained by startSelect, re-arm the poll request for the next select.
+        _ring.pollAdd(_fdIntrRead, POLLIN, ioUringInterruptId);
+        return;
+    }
+
+    auto p = _ioUringRequests.find(completion.userData);
+    assert(p != _ioUringRequests.end());
+    IoUringRequest request = std::move(p->second);
+    _ioUringRequests.erase(p);
+    if (!request.handler)
+    {
+        return; // The request was canceled.
+    }
+
+    auto q = _ioUringHandlers.find(request.handler);
+    assert(q != _ioUringHandlers.end());
+    IoUringHandler& h = q->second;
+    (request.operation == SocketOperationRead ? h.read : h.write) = 0;
+
+    if (request.info)
+    {
+        // The socket gets the result, or the error, when it reads or writes.
+        request.info->result = completion.result;
+        request.info->state.store(AsyncInfo::StateCompleted, memory_order_release);
+    }
+
+    // Poll errors are reported as a ready operation, the handler will get the error from the socket operation.
+    h.completed = static_cast<SocketOperation>(h.completed | request.operation);
+    _ioUringChecks.insert(request.handler);
+}
+#    endif
+
 #elif defined(ICE_USE_CFSTREAM)
 
 namespace
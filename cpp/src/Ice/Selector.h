@@ -6,10 +6,12 @@
 #include "EventHandlerF.h"
 #include "Ice/InstanceF.h"
 #include "Ice/StringUtil.h"
+#include "IoUring.h"
 #include "Network.h"
 #include "UniqueRef.h"
 
 #include <map>
+#include <set>
 
 #if defined(ICE_USE_EPOLL)
 #    include <sys/epoll.h>
@@ -83,6 +85,9 @@ namespace IceInternal
     public:
         Selector(InstancePtr);
 
+#    if defined(ICE_USE_IO_URING)
+        void setupIoUring(const std::string&);
+#    endif
         void destroy();
 
         void initialize(EventHandler*)
@@ -105,6 +110,15 @@ namespace IceInternal
         void checkReady(EventHandler*);
         void updateSelector();
         void updateSelectorForEventHandler(EventHandler*, SocketOperation, SocketOperation);
+#    if defined(ICE_USE_IO_URING)
+        struct IoUringHandler;
+        void updateIoUring(EventHandler*);
+        void updateIoUringRequest(EventHandler*, IoUringHandler&, SocketOperation);
+        void cancelIoUringRequest(std::uint64_t&);
+        [[nodiscard]] bool checkIoUring(const IoUringHandler&) const;
+        [[nodiscard]] SocketOperation ioUringReady(EventHandler*, const IoUringHandler&) const;
+        void ioUringCompleted(const IoUring::Completion&);
+#    endif
 
         const InstancePtr _instance;
 
@@ -119,6 +133,40 @@ namespace IceInternal
 #    if defined(ICE_USE_EPOLL)
         std::vector<struct epoll_event> _events;
         int _queueFd;
+#        if defined(ICE_USE_IO_URING)
+        //
+        // The requests of an event handler: for each of the read and write operations, a one-shot poll request, or
+        // a receive or send request if the socket provides an AsyncInfo for the operation. The requests are queued
+        // with the ring and submitted, with a single system call, by the next select call. They are only submitted
+        // immediately if a thread is already waiting for completions.
+        //
+        struct IoUringHandler
+        {
+            SOCKET fd;
+            std::uint64_t read;        // The ID of the read request, 0 if there's no read request.
+            std::uint64_t write;       // The ID of the write request, 0 if there's no write request.
+            SocketOperation completed; // The operations of the completed requests not reported yet.
+            AsyncInfo* readInfo;
+            AsyncInfo* writeInfo;
+        };
+
+        struct IoUringRequest
+        {
+            EventHandler* handler; // nullptr once the request is canceled.
+            SocketOperation operation;
+            AsyncInfo* info;                              // nullptr for poll requests.
+            std::shared_ptr<std::vector<std::byte>> buf; // Keeps the buffer alive until the request completes.
+        };
+
+        bool _ioUring{false};
+        std::string _ioUringPrefix;
+        IoUring _ring;
+        std::uint64_t _nextRequestId{1}; // 0 is reserved for the interrupt pipe.
+        std::map<EventHandler*, IoUringHandler> _ioUringHandlers;
+        std::map<std::uint64_t, IoUringRequest> _ioUringRequests;
+        std::set<EventHandler*> _ioUringChecks; // The handlers to check on each select, see checkIoUring.
+        std::vector<IoUring::Completion> _completions;
+#        endif
 #    elif defined(ICE_USE_KQUEUE)
         std::vector<struct kevent> _events;
         std::vector<struct kevent> _changes;
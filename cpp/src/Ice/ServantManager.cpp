@@ -21,16 +21,11 @@ IceInternal::ServantManager::addServant(ObjectPtr object, Identity ident, string
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
-
-    if (p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    auto p = _servantMapMap.find(ident);
 
     if (p == _servantMapMap.end())
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(std::move(ident), FacetMap()));
+        p = _servantMapMap.emplace(std::move(ident), FacetMap()).first;
     }
     else
     {
@@ -47,8 +42,6 @@ IceInternal::ServantManager::addServant(ObjectPtr object, Identity ident, string
         }
     }
 
-    _servantMapMapHint = p;
-
     p->second.insert(pair<const string, ObjectPtr>(std::move(facet), std::move(object)));
 }
 
@@ -79,14 +72,9 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string_v
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
+    auto p = _servantMapMap.find(ident);
     FacetMap::iterator q;
 
-    if (p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
-
     if (p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
         ToStringMode toStringMode = _instance->toStringMode();
@@ -104,15 +92,7 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string_v
 
     if (p->second.empty())
     {
-        if (p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        _servantMapMap.erase(p);
     }
     return servant;
 }
@@ -147,12 +127,7 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
-
-    if (p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    auto p = _servantMapMap.find(ident);
 
     if (p == _servantMapMap.end())
     {
@@ -163,17 +138,8 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
             Ice::identityToString(ident, _instance->toStringMode()));
     }
 
-    FacetMap result = p->second;
-
-    if (p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
-    {
-        _servantMapMap.erase(p);
-    }
+    FacetMap result = std::move(p->second);
+    _servantMapMap.erase(p);
 
     return result;
 }
@@ -191,17 +157,10 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string_vie
     //
     // assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    auto& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    auto p = _servantMapMap.find(ident);
+    FacetMap::const_iterator q;
 
-    if (p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if (p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if (p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
         auto d = _defaultServantMap.find(ident.category);
         if (d == _defaultServantMap.end())
@@ -223,7 +182,6 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string_vie
     }
     else
     {
-        _servantMapMapHint = p;
         return q->second;
     }
 }
@@ -251,22 +209,14 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
+    auto p = _servantMapMap.find(ident);
 
-    auto& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if (p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if (p == servantMapMap.end())
+    if (p == _servantMapMap.end())
     {
         return {};
     }
     else
     {
-        _servantMapMapHint = p;
         return p->second;
     }
 }
@@ -284,21 +234,14 @@ IceInternal::ServantManager::hasServant(const Identity& ident) const
     //
     // assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
-    auto& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    auto p = _servantMapMap.find(ident);
 
-    if (p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if (p == servantMapMap.end())
+    if (p == _servantMapMap.end())
     {
         return false;
     }
     else
     {
-        _servantMapMapHint = p;
         assert(!p->second.empty());
         return true;
     }
@@ -397,7 +340,6 @@ IceInternal::ServantManager::findServantLocator(const string_view category) cons
 IceInternal::ServantManager::ServantManager(InstancePtr instance, string adapterName)
     : _instance(std::move(instance)),
       _adapterName(std::move(adapterName)),
-      _servantMapMapHint(_servantMapMap.end()),
       _locatorMapHint(_locatorMap.end())
 {
 }
@@ -425,7 +367,6 @@ IceInternal::ServantManager::destroy()
         logger = _instance->initializationData().logger;
 
         servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
 
         defaultServantMap.swap(_defaultServantMap);
 
@@ -8,9 +8,11 @@
 #include "Ice/InstanceF.h"
 #include "Ice/Object.h"
 #include "Ice/ServantLocator.h"
+#include "HashUtil.h"
 #include "ServantManagerF.h"
 
 #include <mutex>
+#include <unordered_map>
 
 namespace Ice
 {
@@ -49,11 +51,22 @@ namespace IceInternal
 
         const std::string _adapterName;
 
-        using ServantMapMap = std::map<Ice::Identity, Ice::FacetMap>;
+        struct IdentityHash
+        {
+            std::size_t operator()(const Ice::Identity& ident) const noexcept
+            {
+                std::size_t h = 5381;
+                hashAdd(h, ident.name);
+                hashAdd(h, ident.category);
+                return h;
+            }
+        };
+
+        // The servants are indexed by identity with a hash map, as an adapter can host a very large number of servants.
+        using ServantMapMap = std::unordered_map<Ice::Identity, Ice::FacetMap, IdentityHash>;
         using DefaultServantMap = std::map<std::string, Ice::ObjectPtr, std::less<>>;
 
         ServantMapMap _servantMapMap;
-        mutable ServantMapMap::iterator _servantMapMapHint;
 
         DefaultServantMap _defaultServantMap;
 
@@ -4,8 +4,28 @@
 #include "NetworkProxy.h"
 #include "ProtocolInstance.h"
 
+#if !defined(ICE_USE_IOCP)
+#    include <sys/uio.h>
+#endif
+
+#if defined(ICE_USE_IO_URING)
+#    include <algorithm>
+#    include <cstring>
+#endif
+
 using namespace IceInternal;
 
+#if defined(ICE_USE_IO_URING)
+namespace
+{
+    // The size of the buffer of the receive requests. Larger messages are read directly into the connection's buffer.
+    const size_t asyncReadBufferSize = 16 * 1024;
+
+    // The maximum number of bytes copied to the buffer of a send request.
+    const size_t asyncWriteBufferSize = 64 * 1024;
+}
+#endif
+
 StreamSocket::StreamSocket(
     ProtocolInstancePtr instance,
     const NetworkProxyPtr& proxy,
@@ -21,6 +41,12 @@ StreamSocket::StreamSocket(
       ,
       _read(SocketOperationRead),
       _write(SocketOperationWrite)
+#elif defined(ICE_USE_IO_URING)
+      ,
+      _asyncIO(false),
+      _asyncIODisabled(false),
+      _read(SocketOperationRead),
+      _write(SocketOperationWrite)
 #endif
 {
     init();
@@ -51,6 +77,12 @@ StreamSocket::StreamSocket(ProtocolInstancePtr instance, SOCKET fd)
       ,
       _read(SocketOperationRead),
       _write(SocketOperationWrite)
+#elif defined(ICE_USE_IO_URING)
+      ,
+      _asyncIO(true),
+      _asyncIODisabled(false),
+      _read(SocketOperationRead),
+      _write(SocketOperationWrite)
 #endif
 {
     init();
@@ -110,6 +142,9 @@ StreamSocket::connect(Buffer& readBuffer, Buffer& writeBuffer)
     }
 
     assert(_state == StateConnected);
+#if defined(ICE_USE_IO_URING)
+    _asyncIO = !_asyncIODisabled;
+#endif
     return IceInternal::SocketOperationNone;
 }
 
@@ -165,6 +200,22 @@ StreamSocket::read(Buffer& buf)
             }
         }
     }
+#if defined(ICE_USE_IO_URING)
+    //
+    // Once the selector supports receive requests for this socket, the data is always read from the buffer of the
+    // last receive request, and a new receive request is started when this buffer is empty. Like with IOCP, a
+    // receive request is pending while the connection waits for the next message.
+    //
+    if (_read.enabled.load(std::memory_order_acquire))
+    {
+        if (_read.state.load(std::memory_order_acquire) == AsyncInfo::StateIdle)
+        {
+            startRead(buf);
+        }
+        finishRead(buf);
+        return buf.i != buf.b.end() ? SocketOperationRead : SocketOperationNone;
+    }
+#endif
     buf.i += read(reinterpret_cast<char*>(&*buf.i), static_cast<size_t>(buf.b.end() - buf.i));
     return buf.i != buf.b.end() ? SocketOperationRead : SocketOperationNone;
 }
@@ -189,10 +240,154 @@ StreamSocket::write(Buffer& buf)
             }
         }
     }
+#if defined(ICE_USE_IO_URING)
+    if (!finishWrite(buf))
+    {
+        return SocketOperationWrite;
+    }
+#endif
     buf.i += write(reinterpret_cast<const char*>(&*buf.i), static_cast<size_t>(buf.b.end() - buf.i));
+#if defined(ICE_USE_IO_URING)
+    if (buf.i != buf.b.end() && _write.enabled.load(std::memory_order_acquire))
+    {
+        startWrite(buf);
+    }
+#endif
     return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
 }
 
+#if !defined(ICE_USE_IOCP)
+SocketOperation
+StreamSocket::write(const std::vector<Buffer*>& buffers)
+{
+    if (_state != StateConnected)
+    {
+        // Gather writes are only used once the connection is established, the proxy handshake writes a single
+        // buffer at a time.
+        for (Buffer* buf : buffers)
+        {
+            if (buf->i != buf->b.end())
+            {
+                SocketOperation op = write(*buf);
+                if (op != SocketOperationNone)
+                {
+                    return op;
+                }
+            }
+        }
+        return SocketOperationNone;
+    }
+
+    assert(_fd != INVALID_SOCKET);
+
+#    if defined(ICE_USE_IO_URING)
+    if (_write.state.load(std::memory_order_acquire) != AsyncInfo::StateIdle)
+    {
+        auto p = std::find_if(buffers.begin(), buffers.end(), [](Buffer* buf) { return buf->i != buf->b.end(); });
+        assert(p != buffers.end());
+        if (!finishWrite(**p))
+        {
+            return SocketOperationWrite;
+        }
+    }
+#    endif
+
+    const size_t maxIov = 64;
+    iovec iov[maxIov];
+    size_t first = 0;
+    while (true)
+    {
+        int count = 0;
+        for (size_t n = first; n < buffers.size() && count < static_cast<int>(maxIov); ++n)
+        {
+            Buffer* buf = buffers[n];
+            if (buf->i != buf->b.end())
+            {
+                iov[count].iov_base = &*buf->i;
+                iov[count].iov_len = static_cast<size_t>(buf->b.end() - buf->i);
+                ++count;
+            }
+        }
+
+        if (count == 0)
+        {
+            return SocketOperationNone;
+        }
+
+        ssize_t ret = ::writev(_fd, iov, count);
+        if (ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if (ret == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                continue;
+            }
+
+            if (noBuffers())
+            {
+                // Fallback to regular writes, they reduce the packet size when the system runs out of buffers.
+                for (size_t n = first; n < buffers.size(); ++n)
+                {
+                    Buffer* buf = buffers[n];
+                    buf->i +=
+                        write(reinterpret_cast<const char*>(&*buf->i), static_cast<size_t>(buf->b.end() - buf->i));
+                    if (buf->i != buf->b.end())
+                    {
+                        return SocketOperationWrite;
+                    }
+                }
+                return SocketOperationNone;
+            }
+
+            if (wouldBlock())
+            {
+#    if defined(ICE_USE_IO_URING)
+                // The queued messages not written at all can still be canceled, only the data of a message being
+                // sent can be copied to a send request.
+                auto p = std::find_if(
+                    buffers.begin() + static_cast<ptrdiff_t>(first),
+                    buffers.end(),
+                    [](Buffer* buf) { return buf->i != buf->b.end(); });
+                if (_write.enabled.load(std::memory_order_acquire) &&
+                    (p == buffers.begin() || (*p)->i != (*p)->b.begin()))
+                {
+                    startWrite(**p);
+                }
+#    endif
+                return SocketOperationWrite;
+            }
+
+            if (connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        // Advance the buffers by the number of bytes written.
+        auto sent = static_cast<size_t>(ret);
+        for (; first < buffers.size() && sent > 0; ++first)
+        {
+            Buffer* buf = buffers[first];
+            auto remaining = static_cast<size_t>(buf->b.end() - buf->i);
+            if (sent < remaining)
+            {
+                buf->i += static_cast<ptrdiff_t>(sent);
+                break;
+            }
+            buf->i = buf->b.end();
+            sent -= remaining;
+        }
+    }
+}
+#endif
+
 ssize_t
 StreamSocket::read(char* buf, size_t length)
 {
@@ -457,6 +652,151 @@ StreamSocket::finishRead(Buffer& buf)
     }
 }
 
+#elif defined(ICE_USE_IO_URING)
+AsyncInfo*
+StreamSocket::getAsyncInfo(SocketOperation op)
+{
+    if (!_asyncIO.load(std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    switch (op)
+    {
+        case SocketOperationRead:
+            return &_read;
+        case SocketOperationWrite:
+            return &_write;
+        default:
+            return nullptr;
+    }
+}
+
+void
+StreamSocket::disableAsyncIO()
+{
+    _asyncIODisabled = true;
+    _asyncIO = false;
+    _read.enabled = false;
+    _write.enabled = false;
+}
+
+void
+StreamSocket::startWrite(Buffer& buf)
+{
+    // The socket's send buffer is full: copy the remaining data, up to the size of the send buffer, for the selector
+    // to send it with a send request. The caller's buffer is only advanced once the request completes.
+    assert(_write.state.load(std::memory_order_relaxed) == AsyncInfo::StateIdle);
+    if (!_write.buf)
+    {
+        _write.buf = std::make_shared<std::vector<std::byte>>(asyncWriteBufferSize);
+    }
+    _write.end = std::min(static_cast<size_t>(buf.b.end() - buf.i), asyncWriteBufferSize);
+    _write.origin = &*buf.i;
+    memcpy(_write.buf->data(), _write.origin, _write.end);
+    _write.state.store(AsyncInfo::StateStart, std::memory_order_release);
+}
+
+bool
+StreamSocket::finishWrite(Buffer& buf)
+{
+    int state = _write.state.load(std::memory_order_acquire);
+    if (state == AsyncInfo::StateIdle)
+    {
+        return true;
+    }
+    else if (state != AsyncInfo::StateCompleted)
+    {
+        return false; // The send request isn't completed yet.
+    }
+
+    assert(&*buf.i == _write.origin);
+    if (_write.result < 0)
+    {
+        errno = -_write.result;
+        if (connectionLost())
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+        }
+        else
+        {
+            throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+        }
+    }
+    buf.i += _write.result;
+    _write.state.store(AsyncInfo::StateIdle, std::memory_order_relaxed);
+    return true;
+}
+
+void
+StreamSocket::startRead(Buffer&)
+{
+    // The socket has no more data to read, ask the selector to submit a receive request.
+    if (!_read.buf)
+    {
+        _read.buf = std::make_shared<std::vector<std::byte>>(asyncReadBufferSize);
+    }
+    _read.begin = _read.end = 0;
+    _read.state.store(AsyncInfo::StateStart, std::memory_order_release);
+}
+
+void
+StreamSocket::finishRead(Buffer& buf)
+{
+    int state = _read.state.load(std::memory_order_acquire);
+    if (state == AsyncInfo::StateCompleted)
+    {
+        if (_read.result == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if (_read.result < 0)
+        {
+            errno = -_read.result;
+            if (!interrupted() && !wouldBlock())
+            {
+                if (connectionLost())
+                {
+                    throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+                }
+                else
+                {
+                    throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+                }
+            }
+            _read.end = 0;
+        }
+        else
+        {
+            _read.end = static_cast<size_t>(_read.result);
+        }
+        _read.begin = 0;
+    }
+    else if (state != AsyncInfo::StateBuffered)
+    {
+        return; // The receive request isn't completed yet.
+    }
+
+    size_t length = std::min(_read.end - _read.begin, static_cast<size_t>(buf.b.end() - buf.i));
+    memcpy(&*buf.i, _read.buf->data() + _read.begin, length);
+    buf.i += static_cast<ptrdiff_t>(length);
+    _read.begin += length;
+
+    if (_read.begin != _read.end)
+    {
+        _read.state.store(AsyncInfo::StateBuffered, std::memory_order_release);
+        return;
+    }
+
+    // The receive buffer is empty. The remaining data of large messages is read directly into the caller's buffer,
+    // the receive request is only submitted once the socket has no more data to read.
+    auto remaining = static_cast<size_t>(buf.b.end() - buf.i);
+    if (remaining > asyncReadBufferSize)
+    {
+        buf.i += read(reinterpret_cast<char*>(&*buf.i), remaining);
+    }
+    startRead(buf);
+}
 #endif
 
 void
@@ -8,6 +8,7 @@
 #include "ProtocolInstanceF.h"
 
 #include <memory>
+#include <vector>
 
 namespace IceInternal
 {
@@ -27,6 +28,9 @@ namespace IceInternal
 
         SocketOperation read(Buffer&);
         SocketOperation write(Buffer&);
+#if !defined(ICE_USE_IOCP)
+        SocketOperation write(const std::vector<Buffer*>&);
+#endif
 
         ssize_t read(char*, size_t);
         ssize_t write(const char*, size_t);
@@ -37,6 +41,13 @@ namespace IceInternal
         void finishWrite(Buffer&);
         void startRead(Buffer&);
         void finishRead(Buffer&);
+#elif defined(ICE_USE_IO_URING)
+        AsyncInfo* getAsyncInfo(SocketOperation) override;
+        void disableAsyncIO() override;
+        void startWrite(Buffer&);
+        bool finishWrite(Buffer&);
+        void startRead(Buffer&);
+        void finishRead(Buffer&);
 #endif
 
         void close();
@@ -69,6 +80,11 @@ namespace IceInternal
         size_t _maxRecvPacketSize;
         AsyncInfo _read;
         AsyncInfo _write;
+#elif defined(ICE_USE_IO_URING)
+        std::atomic<bool> _asyncIO;
+        bool _asyncIODisabled;
+        AsyncInfo _read;
+        AsyncInfo _write;
 #endif
     };
     using StreamSocketPtr = std::shared_ptr<StreamSocket>;
@@ -55,6 +55,14 @@ IceInternal::TcpTransceiver::read(Buffer& buf)
     return _stream->read(buf);
 }
 
+#    if !defined(ICE_USE_IOCP)
+SocketOperation
+IceInternal::TcpTransceiver::gatherWrite(const vector<Buffer*>& buffers)
+{
+    return _stream->write(buffers);
+}
+#    endif
+
 #    if defined(ICE_USE_IOCP)
 bool
 IceInternal::TcpTransceiver::startWrite(Buffer& buf)
@@ -26,6 +26,9 @@ namespace IceInternal
         void close() final;
         SocketOperation write(Buffer&) final;
         SocketOperation read(Buffer&) final;
+#if !defined(ICE_USE_IOCP)
+        SocketOperation gatherWrite(const std::vector<Buffer*>&) final;
+#endif
 #if defined(ICE_USE_IOCP)
         bool startWrite(Buffer&) final;
         void finishWrite(Buffer&) final;
@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "ThreadPool.h"
+#include "BufferPool.h"
 #include "EventHandler.h"
 #include "Ice/LocalExceptions.h"
 #include "Ice/LoggerUtil.h"
@@ -29,9 +30,15 @@ namespace
     class ThreadPoolDestroyedException
     {
     };
+
+    // The number of work items that can be queued before the work queue falls back to a list protected by the thread
+    // pool mutex.
+    const size_t workQueueCapacity = 1024;
 }
 
-IceInternal::ThreadPoolWorkQueue::ThreadPoolWorkQueue(ThreadPool& threadPool) : _threadPool(threadPool)
+IceInternal::ThreadPoolWorkQueue::ThreadPoolWorkQueue(ThreadPool& threadPool)
+    : _threadPool(threadPool),
+      _workItems(workQueueCapacity)
 {
     _registered = SocketOperationRead;
 }
@@ -50,14 +57,88 @@ IceInternal::ThreadPoolWorkQueue::destroy()
 }
 
 void
-IceInternal::ThreadPoolWorkQueue::queue(function<void(ThreadPoolCurrent&)> item)
+IceInternal::ThreadPoolWorkQueue::queue(WorkItem item)
+{
+    // lock_guard lock(_mutex); Called with the thread pool locked
+    if (_overflowing || !_workItems.tryPush(item))
+    {
+        _overflow.push_back(std::move(item));
+        _overflowing = true;
+    }
+    ++_pending;
+    setReady();
+}
+
+bool
+IceInternal::ThreadPoolWorkQueue::post(WorkItem item)
+{
+    //
+    // _producers and _destroyed are sequentially consistent: either this call sees the work queue as destroyed or
+    // message() sees this call in progress and waits for the item to be queued.
+    //
+    ++_producers;
+    if (_destroyed)
+    {
+        --_producers;
+        return false;
+    }
+
+    if (!_overflowing && _workItems.tryPush(item))
+    {
+#if defined(ICE_USE_IOCP)
+        ++_pending;
+        _threadPool._selector.completed(this, SocketOperationRead);
+#else
+        if (_pending++ == 0)
+        {
+            // The queue was empty, the work queue needs to be marked as ready.
+            lock_guard lock(_threadPool._mutex);
+            setReady();
+        }
+#endif
+    }
+    else
+    {
+        lock_guard lock(_threadPool._mutex);
+        _overflow.push_back(std::move(item));
+        _overflowing = true;
+        ++_pending;
+        setReady();
+    }
+    --_producers;
+    return true;
+}
+
+bool
+IceInternal::ThreadPoolWorkQueue::pop(WorkItem& item)
+{
+    if (_workItems.tryPop(item))
+    {
+        return true;
+    }
+
+    if (_overflowing)
+    {
+        lock_guard lock(_threadPool._mutex);
+        if (!_overflow.empty())
+        {
+            item = std::move(_overflow.front());
+            _overflow.pop_front();
+            _overflowing = !_overflow.empty();
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+IceInternal::ThreadPoolWorkQueue::setReady()
 {
     // lock_guard lock(_mutex); Called with the thread pool locked
-    _workItems.push_back(std::move(item));
 #if defined(ICE_USE_IOCP)
     _threadPool._selector.completed(this, SocketOperationRead);
 #else
-    if (_workItems.size() == 1)
+    if (_pending > 0)
     {
         _threadPool._selector.ready(this, SocketOperationRead, true);
     }
@@ -83,38 +164,57 @@ IceInternal::ThreadPoolWorkQueue::finishAsync(SocketOperation)
 void
 IceInternal::ThreadPoolWorkQueue::message(ThreadPoolCurrent& current)
 {
-    function<void(ThreadPoolCurrent&)> workItem;
+    WorkItem workItem;
+    if (!pop(workItem) && _destroyed)
     {
-        lock_guard lock(_threadPool._mutex);
-        if (!_workItems.empty())
+        // Wait for the post calls which didn't see the destroyed flag to queue their work item.
+        while (_producers > 0)
         {
-            workItem = std::move(_workItems.front());
-            _workItems.pop_front();
+            this_thread::yield();
         }
+        pop(workItem);
+    }
+
+    if (workItem)
+    {
 #if defined(ICE_USE_IOCP)
-        else
-        {
-            assert(_destroyed);
-            _threadPool._selector.completed(this, SocketOperationRead);
-        }
+        --_pending;
 #else
-        if (_workItems.empty() && !_destroyed)
+        if (--_pending == 0)
         {
-            _threadPool._selector.ready(this, SocketOperationRead, false);
+            lock_guard lock(_threadPool._mutex);
+            if (_pending <= 0 && !_destroyed)
+            {
+                _threadPool._selector.ready(this, SocketOperationRead, false);
+            }
         }
 #endif
-    }
-
-    if (workItem)
-    {
         workItem(current);
     }
-    else
+    else if (_destroyed)
     {
-        assert(_destroyed);
+#if defined(ICE_USE_IOCP)
+        _threadPool._selector.completed(this, SocketOperationRead); // Wake up the next thread.
+#endif
         current.ioCompleted();
         throw ThreadPoolDestroyedException();
     }
+    else
+    {
+        //
+        // The work item was taken by another thread or it's not fully queued yet. It's fine to return without doing
+        // anything: the work queue remains ready as long as there are pending work items.
+        //
+#if defined(ICE_USE_IOCP)
+        _threadPool._selector.completed(this, SocketOperationRead);
+#else
+        lock_guard lock(_threadPool._mutex);
+        if (_pending <= 0 && !_destroyed)
+        {
+            _threadPool._selector.ready(this, SocketOperationRead, false);
+        }
+#endif
+    }
 }
 
 void
@@ -143,10 +243,11 @@ IceInternal::ThreadPool::create(const InstancePtr& instance, const string& prefi
     return threadPool;
 }
 
-IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, string prefix, int timeout)
+IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, string prefix, int timeout, int shard)
     : _instance(instance),
       _executor(_instance->initializationData().executor),
       _prefix(std::move(prefix)),
+      _shard(shard),
       _selector(instance),
       _serialize(_instance->initializationData().properties->getPropertyAsInt(_prefix + ".Serialize") > 0),
       _serverIdleTime(timeout)
@@ -234,14 +335,42 @@ IceInternal::ThreadPool::initialize()
         threadIdleTime = 0;
     }
 
+    int shards = 1;
+    if (_shard < 0) // Shards are only created by the first shard.
+    {
+        shards = properties->getPropertyAsIntWithDefault(_prefix + ".Shards", 1);
+        if (shards < 1)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".Shards < 1; Shards adjusted to 1";
+            shards = 1;
+        }
+        else if (shards > 1 && _serverIdleTime > 0)
+        {
+            // The server idle time is computed for a single selector.
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".Shards is ignored when Ice.ServerIdleTime is set";
+            shards = 1;
+        }
+        else if (shards > 1)
+        {
+            const_cast<int&>(_shard) = 0;
+        }
+    }
+
     const_cast<int&>(_size) = size;
     const_cast<int&>(_sizeMax) = sizeMax;
     const_cast<int&>(_sizeWarn) = sizeWarn;
     const_cast<int&>(_sizeIO) = min(sizeMax, nProcessors);
     const_cast<int&>(_threadIdleTime) = threadIdleTime;
 
-#ifdef ICE_USE_IOCP
+#if defined(ICE_USE_IOCP)
     _selector.setup(_sizeIO);
+#elif defined(ICE_USE_IO_URING)
+    if (properties->getPropertyAsInt(_prefix + ".IoUring") > 0)
+    {
+        _selector.setupIoUring(_prefix);
+    }
 #endif
 
     _workQueue = make_shared<ThreadPoolWorkQueue>(*this);
@@ -250,8 +379,12 @@ IceInternal::ThreadPool::initialize()
     if (_instance->traceLevels()->threadPool >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
-        out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax
-            << ", SizeWarn = " << _sizeWarn;
+        out << "creating " << _prefix;
+        if (_shard >= 0)
+        {
+            out << " shard " << _shard;
+        }
+        out << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = " << _sizeWarn;
     }
 
     try
@@ -262,6 +395,13 @@ IceInternal::ThreadPool::initialize()
             thread->start();
             _threads.insert(std::move(thread));
         }
+
+        for (int i = 1; i < shards; ++i)
+        {
+            auto shard = std::shared_ptr<ThreadPool>(new ThreadPool(_instance, _prefix, 0, i));
+            shard->initialize(); // Destroys the shard on failure.
+            _shards.push_back(std::move(shard));
+        }
     }
     catch (const Ice::Exception& ex)
     {
@@ -288,6 +428,11 @@ IceInternal::ThreadPool::destroy()
     }
     _destroyed = true;
     _workQueue->destroy();
+
+    for (const auto& shard : _shards)
+    {
+        shard->destroy();
+    }
 }
 
 void
@@ -298,6 +443,11 @@ IceInternal::ThreadPool::updateObservers()
     {
         p->updateObserver();
     }
+
+    for (const auto& shard : _shards)
+    {
+        shard->updateObservers();
+    }
 }
 
 void
@@ -407,52 +557,29 @@ IceInternal::ThreadPool::ready(const EventHandlerPtr& handler, SocketOperation o
 }
 
 void
-IceInternal::ThreadPool::executeFromThisThread(function<void()> call, const Ice::ConnectionPtr& connection)
+IceInternal::ThreadPool::executeWithExecutor(function<void()> call, const Ice::ConnectionPtr& connection)
 {
-    if (_executor)
+    assert(_executor);
+    try
     {
-        try
-        {
-            _executor(std::move(call), connection);
-        }
-        catch (const std::exception& ex)
-        {
-            if (_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Executor") > 1)
-            {
-                Warning out(_instance->initializationData().logger);
-                out << "executor exception:\n" << ex;
-            }
-        }
-        catch (...)
-        {
-            if (_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Executor") > 1)
-            {
-                Warning out(_instance->initializationData().logger);
-                out << "executor exception: unknown c++ exception";
-            }
-        }
+        _executor(std::move(call), connection);
     }
-    else
+    catch (const std::exception& ex)
     {
-        call();
+        if (_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Executor") > 1)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "executor exception:\n" << ex;
+        }
     }
-}
-
-void
-IceInternal::ThreadPool::execute(function<void()> call, const Ice::ConnectionPtr& connection)
-{
-    lock_guard lock(_mutex);
-    if (_destroyed)
+    catch (...)
     {
-        throw CommunicatorDestroyedException(__FILE__, __LINE__);
-    }
-
-    _workQueue->queue(
-        [self = shared_from_this(), call = std::move(call), connection](ThreadPoolCurrent& current)
+        if (_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Executor") > 1)
         {
-            current.ioCompleted(); // Promote new leader
-            self->executeFromThisThread(call, connection);
-        });
+            Warning out(_instance->initializationData().logger);
+            out << "executor exception: unknown c++ exception";
+        }
+    }
 }
 
 void
@@ -471,6 +598,11 @@ IceInternal::ThreadPool::joinWithAllThreads()
         thread->join();
     }
     _selector.destroy();
+
+    for (const auto& shard : _shards)
+    {
+        shard->joinWithAllThreads();
+    }
 }
 
 string
@@ -479,6 +611,18 @@ IceInternal::ThreadPool::prefix() const
     return _prefix;
 }
 
+ThreadPoolPtr
+IceInternal::ThreadPool::getShard()
+{
+    if (_shards.empty())
+    {
+        return shared_from_this();
+    }
+
+    size_t shard = _nextShard++ % (_shards.size() + 1);
+    return shard == 0 ? shared_from_this() : _shards[shard - 1];
+}
+
 void
 IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
 {
@@ -974,7 +1118,12 @@ string
 IceInternal::ThreadPool::nextThreadId()
 {
     ostringstream os;
-    os << _prefix << "-" << _nextThreadId++;
+    os << _prefix << "-";
+    if (_shard >= 0)
+    {
+        os << _shard << "-";
+    }
+    os << _nextThreadId++;
     return os.str();
 }
 
@@ -1078,6 +1227,19 @@ IceInternal::ThreadPool::EventHandlerThread::run()
 
     _observer.detach();
 
+    if (_pool->_instance->traceLevels()->threadPool >= 2)
+    {
+        BufferPool::Stats stats = BufferPool::getStats();
+        uint64_t total = stats.hits + stats.misses;
+        Trace out(_pool->_instance->initializationData().logger, _pool->_instance->traceLevels()->threadPoolCat);
+        out << "buffer pool statistics for thread '" << _name << "': " << stats.hits << " hits, " << stats.misses
+            << " misses";
+        if (total > 0)
+        {
+            out << " (" << (stats.hits * 100 / total) << "% hit rate)";
+        }
+    }
+
     if (_pool->_instance->initializationData().threadStop)
     {
         try
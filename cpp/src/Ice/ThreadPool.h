@@ -7,15 +7,19 @@
 #include "Ice/Config.h"
 #include "Ice/InputStream.h"
 #include "Ice/InstanceF.h"
+#include "Ice/LocalExceptions.h"
 #include "Ice/Logger.h"
 #include "Ice/ObserverHelper.h"
 #include "Ice/PropertiesF.h"
 #include "Selector.h"
 #include "ThreadPoolF.h"
+#include "WorkItemQueue.h"
 
+#include <atomic>
 #include <list>
 #include <set>
 #include <thread>
+#include <vector>
 
 namespace IceInternal
 {
@@ -68,15 +72,24 @@ namespace IceInternal
         bool finish(const EventHandlerPtr&, bool);
         void ready(const EventHandlerPtr&, SocketOperation, bool);
 
-        void executeFromThisThread(std::function<void()>, const Ice::ConnectionPtr&);
-        void execute(std::function<void()>, const Ice::ConnectionPtr&);
+        // Calls the given callable from this thread, with the executor of the communicator if it has one.
+        template<typename F> void executeFromThisThread(F&&, const Ice::ConnectionPtr&);
+
+        // Calls the given callable from a thread of this thread pool, or of one of its shards. The callable is stored
+        // in the work item queued to the thread pool, it's only converted to a std::function if the communicator has
+        // an executor.
+        template<typename F> void execute(F&&, const Ice::ConnectionPtr&);
 
         void joinWithAllThreads();
 
         [[nodiscard]] std::string prefix() const;
 
+        // Returns the shard of this thread pool that should handle a new connection or call. The shards are assigned
+        // in round-robin order. Returns this thread pool if the thread pool isn't sharded.
+        ThreadPoolPtr getShard();
+
     private:
-        ThreadPool(const InstancePtr&, std::string, int);
+        ThreadPool(const InstancePtr&, std::string, int, int = -1);
         void initialize();
 
         void run(const EventHandlerThreadPtr&);
@@ -93,6 +106,8 @@ namespace IceInternal
 
         std::string nextThreadId();
 
+        void executeWithExecutor(std::function<void()>, const Ice::ConnectionPtr&);
+
         static void joinThread(const EventHandlerThreadPtr&);
         static void shutdown(const ThreadPoolCurrent&, const InstancePtr&);
 
@@ -103,6 +118,7 @@ namespace IceInternal
         ThreadPoolWorkQueuePtr _workQueue;
         bool _destroyed{false};
         const std::string _prefix;
+        const int _shard; // The index of this shard or -1 if the thread pool isn't sharded.
         Selector _selector;
         int _nextThreadId{0};
 
@@ -129,6 +145,11 @@ namespace IceInternal
         bool _promote{true};
         std::mutex _mutex;
         std::condition_variable _conditionVariable;
+
+        // With a sharded thread pool, this thread pool is the first shard and _shards contains the other shards.
+        // Each shard has its own selector and threads. _shards is immutable once the thread pool is initialized.
+        std::vector<ThreadPoolPtr> _shards;
+        std::atomic<size_t> _nextShard{0};
     };
 
     class ThreadPoolCurrent
@@ -171,7 +192,13 @@ namespace IceInternal
         ThreadPoolWorkQueue(ThreadPool&);
 
         void destroy();
-        void queue(std::function<void(ThreadPoolCurrent&)>);
+
+        // Queues a work item, must be called with the thread pool mutex locked.
+        void queue(WorkItem);
+
+        // Queues a work item without locking the thread pool mutex unless the queue was empty or is full. Returns
+        // false if the work queue is destroyed.
+        bool post(WorkItem);
 
 #if defined(ICE_USE_IOCP)
         bool startAsync(SocketOperation);
@@ -184,9 +211,20 @@ namespace IceInternal
         NativeInfoPtr getNativeInfo() override;
 
     private:
+        bool pop(WorkItem&);
+        void setReady();
+
         ThreadPool& _threadPool;
-        bool _destroyed{false};
-        std::list<std::function<void(ThreadPoolCurrent&)>> _workItems;
+        std::atomic<bool> _destroyed{false};
+        WorkItemQueue _workItems;
+
+        // Work items queued while _workItems is full, protected by the thread pool mutex. Once an item overflows, new
+        // items are queued here until it's drained to preserve the ordering.
+        std::list<WorkItem> _overflow;
+        std::atomic<bool> _overflowing{false};
+
+        std::atomic<int> _pending{0};   // Number of queued items, it can be briefly off by the items being pushed.
+        std::atomic<int> _producers{0}; // Number of post calls in progress.
     };
 
 //
@@ -300,6 +338,33 @@ namespace IceInternal
     };
 #endif
 
+    template<typename F> void ThreadPool::executeFromThisThread(F&& call, const Ice::ConnectionPtr& connection)
+    {
+        if (_executor)
+        {
+            executeWithExecutor(std::function<void()>(std::forward<F>(call)), connection);
+        }
+        else
+        {
+            call();
+        }
+    }
+
+    template<typename F> void ThreadPool::execute(F&& call, const Ice::ConnectionPtr& connection)
+    {
+        // The calls are spread over the shards in round-robin order. The first shard keeps the other shards alive and
+        // the thread pool threads keep the first shard alive, there's no need to capture a shared_ptr.
+        ThreadPool& shard = _shards.empty() ? *this : *getShard();
+        if (!shard._workQueue->post(
+                [&shard, call = std::forward<F>(call), connection](ThreadPoolCurrent& current) mutable
+                {
+                    current.ioCompleted(); // Promote new leader
+                    shard.executeFromThisThread(std::move(call), connection);
+                }))
+        {
+            throw Ice::CommunicatorDestroyedException(__FILE__, __LINE__);
+        }
+    }
 };
 
 #endif
@@ -4,13 +4,35 @@
 #include "ConsoleUtil.h"
 #include "Ice/Exception.h"
 
+#include <algorithm>
+#include <limits>
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+namespace
+{
+    // Returns the number of milliseconds elapsed, rounded up so that tasks never run before their scheduled time.
+    uint64_t toTickRoundUp(chrono::steady_clock::duration elapsed)
+    {
+        return static_cast<uint64_t>(chrono::ceil<chrono::milliseconds>(elapsed).count());
+    }
+
+    uint64_t toTick(chrono::steady_clock::duration elapsed)
+    {
+        return static_cast<uint64_t>(chrono::floor<chrono::milliseconds>(elapsed).count());
+    }
+}
+
 TimerTask::~TimerTask() = default; // Out of line to avoid weak vtable
 
-Timer::Timer() : _wakeUpTime(chrono::steady_clock::time_point()), _worker(&Timer::run, this) {}
+Timer::Timer()
+    : _start(chrono::steady_clock::now()),
+      _wakeUpTime(chrono::steady_clock::time_point()),
+      _worker(&Timer::run, this)
+{
+}
 
 void
 Timer::destroy()
@@ -27,7 +49,15 @@ Timer::destroy()
         }
         _destroyed = true;
         _tasks.clear();
-        _tokens.clear();
+        for (auto& level : _wheel)
+        {
+            for (auto& slot : level)
+            {
+                slot.clear();
+            }
+        }
+        _ready.clear();
+        _running.clear();
         _condition.notify_one();
     }
     _worker.join();
@@ -51,59 +81,72 @@ Timer::isScheduled(const TimerTaskPtr& task)
     return _tasks.find(task) != _tasks.end();
 }
 
+Timer::Statistics
+Timer::getStatistics()
+{
+    lock_guard lock(_mutex);
+    Statistics statistics = _statistics;
+    statistics.scheduledTasks = _tasks.size();
+    return statistics;
+}
+
 void
 Timer::run()
 {
-    Token token{chrono::steady_clock::time_point(), nullopt, nullptr};
+    TimerTaskPtr task;
     while (true)
     {
         {
             unique_lock lock(_mutex);
 
-            if (!_destroyed)
+            // If the task we just ran is a repeated task, schedule it again for execution if it wasn't canceled.
+            if (!_destroyed && !_running.empty())
             {
-                // If the task we just ran is a repeated task, schedule it again for execution if it wasn't canceled.
-                if (token.delay)
+                auto p = _running.begin();
+                p->scheduledTime = chrono::steady_clock::now() + p->delay.value();
+                p->tick = toTickRoundUp(p->scheduledTime - _start);
+                insertNoSync(_running, p);
+            }
+
+            while (!_destroyed)
+            {
+                const auto now = chrono::steady_clock::now();
+                advanceNoSync(toTick(now - _start));
+                if (!_ready.empty())
                 {
-                    auto p = _tasks.find(token.task);
-                    if (p != _tasks.end())
+                    auto p = _ready.begin();
+                    task = p->task;
+
+                    auto lateness = max(chrono::nanoseconds::zero(), chrono::nanoseconds(now - p->scheduledTime));
+                    ++_statistics.runTasks;
+                    _statistics.totalLateness += lateness;
+                    _statistics.maxLateness = max(_statistics.maxLateness, lateness);
+
+                    if (p->delay)
+                    {
+                        // Keep the token of the repeated task while it runs: it remains scheduled until canceled.
+                        _running.splice(_running.end(), _ready, p);
+                        p->slot = &_running;
+                    }
+                    else
                     {
-                        token.scheduledTime = chrono::steady_clock::now() + token.delay.value();
-                        p->second = token.scheduledTime;
-                        _tokens.insert(token);
+                        _tasks.erase(task);
+                        _ready.erase(p);
                     }
+                    break;
                 }
-                token = {chrono::steady_clock::time_point(), nullopt, nullptr};
 
-                if (_tokens.empty())
+                uint64_t nextTick = nextTickNoSync();
+                if (nextTick == numeric_limits<uint64_t>::max())
                 {
                     _wakeUpTime = chrono::steady_clock::time_point();
                     _condition.wait(lock);
                 }
-            }
-
-            if (_destroyed)
-            {
-                break;
-            }
-
-            while (!_tokens.empty() && !_destroyed)
-            {
-                const auto now = chrono::steady_clock::now();
-                const Token& first = *(_tokens.begin());
-                if (first.scheduledTime <= now)
+                else
                 {
-                    token = first;
-                    _tokens.erase(_tokens.begin());
-                    if (!token.delay)
-                    {
-                        _tasks.erase(token.task);
-                    }
-                    break;
+                    _wakeUpTime = _start + chrono::milliseconds(nextTick);
+                    _condition.wait_until(lock, _wakeUpTime);
                 }
-
-                _wakeUpTime = first.scheduledTime;
-                _condition.wait_for(lock, first.scheduledTime - now);
             }
 
             if (_destroyed)
@@ -112,11 +155,11 @@ Timer::run()
             }
         }
 
-        if (token.task)
+        if (task)
         {
             try
             {
-                runTimerTask(token.task);
+                runTimerTask(task);
             }
             catch (const Ice::Exception& e)
             {
@@ -131,15 +174,125 @@ Timer::run()
                 consoleErr << "Ice::Timer::run(): uncaught exception" << endl;
             }
 
-            if (!token.delay)
+            // Clear the task reference now rather than in the synchronization block above. Clearing the task
+            // reference might end up calling user code which could trigger a deadlock. See also issue #352.
+            task = nullptr;
+        }
+    }
+}
+
+void
+Timer::scheduleNoSync(
+    const TimerTaskPtr& task,
+    chrono::steady_clock::time_point time,
+    optional<chrono::nanoseconds> delay)
+{
+    Slot slot;
+    slot.push_back({time, delay, task, toTickRoundUp(time - _start), &slot});
+    auto p = slot.begin();
+    insertNoSync(slot, p);
+    _tasks.emplace(task, p);
+    _statistics.maxScheduledTasks = max(_statistics.maxScheduledTasks, _tasks.size());
+
+    if (_wakeUpTime == chrono::steady_clock::time_point() || time < _wakeUpTime)
+    {
+        _condition.notify_one();
+    }
+}
+
+void
+Timer::insertNoSync(Slot& from, Slot::iterator p)
+{
+    Slot* slot = &_ready;
+    if (p->tick > _currentTick)
+    {
+        uint64_t tick = p->tick;
+        uint64_t delta = tick - _currentTick;
+        size_t level = 0;
+        while (level < LevelCount - 1 && delta >= (uint64_t{1} << (SlotBits * (level + 1))))
+        {
+            ++level;
+        }
+
+        if (delta >= (uint64_t{1} << (SlotBits * LevelCount)))
+        {
+            // Beyond the range of the wheel, the token is moved down once the last slot of the top level is reached.
+            tick = _currentTick + (uint64_t{1} << (SlotBits * LevelCount)) - 1;
+        }
+        slot = &_wheel[level][(tick >> (SlotBits * level)) & (SlotCount - 1)];
+    }
+    slot->splice(slot->end(), from, p);
+    p->slot = slot;
+}
+
+void
+Timer::advanceNoSync(uint64_t tick)
+{
+    while (_currentTick < tick)
+    {
+        // Skip the ticks without tokens to expire or to move down.
+        uint64_t nextTick = nextTickNoSync();
+        if (nextTick > tick)
+        {
+            _currentTick = tick;
+            break;
+        }
+        _currentTick = nextTick;
+
+        // Move down the tokens of the slots that start at this tick, from the top level down to level 1.
+        for (size_t level = LevelCount - 1; level > 0; --level)
+        {
+            const unsigned int shift = SlotBits * static_cast<unsigned int>(level);
+            if ((_currentTick & ((uint64_t{1} << shift) - 1)) == 0)
+            {
+                Slot& slot = _wheel[level][(_currentTick >> shift) & (SlotCount - 1)];
+                while (!slot.empty())
+                {
+                    insertNoSync(slot, slot.begin());
+                }
+            }
+        }
+
+        Slot& slot = _wheel[0][_currentTick & (SlotCount - 1)];
+        for (auto& token : slot)
+        {
+            token.slot = &_ready;
+        }
+        _ready.splice(_ready.end(), slot);
+    }
+}
+
+uint64_t
+Timer::nextTickNoSync() const
+{
+    uint64_t nextTick = numeric_limits<uint64_t>::max();
+
+    // The level 0 slots hold the tokens of the next SlotCount - 1 ticks.
+    for (uint64_t i = 1; i < SlotCount; ++i)
+    {
+        if (!_wheel[0][(_currentTick + i) & (SlotCount - 1)].empty())
+        {
+            nextTick = _currentTick + i;
+            break;
+        }
+    }
+
+    // The tokens of a higher level slot are moved down at the first tick covered by this slot. A slot with the same
+    // index as the current one covers the ticks of the next rotation of the level.
+    for (size_t level = 1; level < LevelCount; ++level)
+    {
+        const unsigned int shift = SlotBits * static_cast<unsigned int>(level);
+        const uint64_t current = _currentTick >> shift;
+        for (uint64_t i = 1; i <= SlotCount; ++i)
+        {
+            if (!_wheel[level][(current + i) & (SlotCount - 1)].empty())
             {
-                // If the task is not a repeated task, clear the task reference now rather than
-                // in the synchronization block above. Clearing the task reference might end up
-                // calling user code which could trigger a deadlock. See also issue #352.
-                token.task = nullptr;
+                nextTick = min(nextTick, (current + i) << shift);
+                break;
             }
         }
     }
+    return nextTick;
 }
 
 bool
@@ -156,7 +309,7 @@ Timer::cancelNoSync(const TimerTaskPtr& task)
         return false;
     }
 
-    _tokens.erase(Token{p->second, nullopt, p->first});
+    p->second->slot->erase(p->second);
     _tasks.erase(p);
 
     return true;
@@ -6,16 +6,18 @@
 #include "Ice/Config.h"
 #include "Ice/TimerTask.h"
 
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
-#include <map>
+#include <list>
 #include <mutex>
 #include <optional>
-#include <set>
 #include <stdexcept>
 #include <thread>
+#include <unordered_map>
 
 namespace IceInternal
 {
@@ -80,17 +82,11 @@ namespace IceInternal
                 throw std::invalid_argument("delay too large, resulting in overflow");
             }
 
-            bool inserted = _tasks.insert(make_pair(task, time)).second;
-            if (!inserted)
+            if (_tasks.find(task) != _tasks.end())
             {
                 throw std::invalid_argument("task is already scheduled");
             }
-            _tokens.insert({time, std::nullopt, task});
-
-            if (_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-            {
-                _condition.notify_one();
-            }
+            scheduleNoSync(task, time, std::nullopt);
         }
 
         // Reschedule a task for execution after a given delay. This function also succeeds if the task was not
@@ -117,14 +113,7 @@ namespace IceInternal
             }
 
             cancelNoSync(task);
-
-            _tasks.insert(make_pair(task, time));
-            _tokens.insert({time, std::nullopt, task});
-
-            if (_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-            {
-                _condition.notify_one();
-            }
+            scheduleNoSync(task, time, std::nullopt);
         }
 
         // Schedule a task for repeated execution with the given delay between each execution.
@@ -149,17 +138,11 @@ namespace IceInternal
                 throw std::invalid_argument("delay too large, resulting in overflow");
             }
 
-            bool inserted = _tasks.insert(make_pair(task, time)).second;
-            if (!inserted)
+            if (_tasks.find(task) != _tasks.end())
             {
                 throw std::invalid_argument("task is already scheduled");
             }
-            _tokens.insert({time, std::chrono::duration_cast<std::chrono::nanoseconds>(delay), task});
-
-            if (_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-            {
-                _condition.notify_one();
-            }
+            scheduleNoSync(task, time, std::chrono::duration_cast<std::chrono::nanoseconds>(delay));
         }
 
         //
@@ -173,36 +156,71 @@ namespace IceInternal
         // Checks if this timer task is scheduled.
         bool isScheduled(const TimerTaskPtr&);
 
+        struct Statistics
+        {
+            // The number of tasks currently scheduled.
+            std::size_t scheduledTasks{0};
+
+            // The largest number of tasks scheduled at the same time.
+            std::size_t maxScheduledTasks{0};
+
+            // The number of task executions.
+            std::uint64_t runTasks{0};
+
+            // The sum and the maximum of the delays between the scheduled time of the tasks and their execution.
+            std::chrono::nanoseconds totalLateness{0};
+            std::chrono::nanoseconds maxLateness{0};
+        };
+
+        // Returns the statistics of this timer.
+        Statistics getStatistics();
+
     protected:
         virtual void runTimerTask(const TimerTaskPtr&);
 
     private:
+        //
+        // The scheduled tasks are stored in a hierarchical timing wheel with a resolution of one millisecond: level 0
+        // holds the tasks due in the next 64 ticks, one slot per tick, and each slot of level N covers 64 slots of
+        // level N - 1. When the current tick reaches the first tick covered by a slot of level N > 0, the tasks of
+        // this slot are moved down to the lower levels. Tasks due beyond the range of the wheel (about 4.6 hours) are
+        // kept in the last slot of the top level until they get closer. Scheduling and cancelling a task is O(1).
+        //
+        static constexpr unsigned int SlotBits = 6;
+        static constexpr std::size_t SlotCount = 1 << SlotBits;
+        static constexpr std::size_t LevelCount = 4;
+
+        struct Token;
+        using Slot = std::list<Token>;
+
         struct Token
         {
             std::chrono::steady_clock::time_point scheduledTime;
             std::optional<std::chrono::nanoseconds> delay;
             TimerTaskPtr task;
-            bool operator<(const Token& other) const
-            {
-                if (scheduledTime < other.scheduledTime)
-                {
-                    return true;
-                }
-                else if (scheduledTime > other.scheduledTime)
-                {
-                    return false;
-                }
-                return task < other.task;
-            }
+            std::uint64_t tick;
+            Slot* slot; // The slot or list holding this token.
         };
 
         void run();
+        void scheduleNoSync(
+            const TimerTaskPtr&,
+            std::chrono::steady_clock::time_point,
+            std::optional<std::chrono::nanoseconds>);
+        void insertNoSync(Slot&, Slot::iterator);
+        void advanceNoSync(std::uint64_t);
+        [[nodiscard]] std::uint64_t nextTickNoSync() const;
         bool cancelNoSync(const TimerTaskPtr& task);
 
         std::mutex _mutex;
         std::condition_variable _condition;
-        std::set<Token> _tokens;
-        std::map<TimerTaskPtr, std::chrono::steady_clock::time_point> _tasks;
+        const std::chrono::steady_clock::time_point _start;
+        std::uint64_t _currentTick{0}; // The last tick processed by advanceNoSync.
+        std::array<std::array<Slot, SlotCount>, LevelCount> _wheel;
+        Slot _ready;   // The tokens due for execution, in execution order.
+        Slot _running; // The token of the repeated task being executed, if any.
+        std::unordered_map<TimerTaskPtr, Slot::iterator> _tasks;
+        Statistics _statistics;
         bool _destroyed{false};
         std::chrono::steady_clock::time_point _wakeUpTime;
         std::thread _worker;
@@ -152,30 +152,49 @@ printHeader(ostream& s, InputStream& stream)
     stream.read(compress);
     s << "\ncompression status = " << static_cast<int>(compress) << ' ';
 
-    switch (compress)
+    if (type == validateConnectionMsg && compress != 0)
     {
-        case 0:
+        // The server side advertises the codecs it supports other than bzip2 (heartbeats advertise none).
+        s << "(supported codecs = bzip2";
+        for (uint8_t status = 3; status < 11; ++status)
         {
-            s << "(not compressed; do not compress response, if any)";
-            break;
+            if ((compress & (1 << (status - 3))) != 0)
+            {
+                const CompressionCodec* codec = findCompressionCodec(status);
+                s << ", " << (codec ? codec->name() : "unknown codec " + to_string(status));
+            }
         }
-
-        case 1:
+        s << ')';
+    }
+    else
+    {
+        switch (compress)
         {
-            s << "(not compressed; compress response, if any)";
-            break;
-        }
+            case 0:
+            {
+                s << "(not compressed; do not compress response, if any)";
+                break;
+            }
 
-        case 2:
-        {
-            s << "(compressed; compress response, if any)";
-            break;
-        }
+            case 1:
+            {
+                s << "(not compressed; compress response, if any)";
+                break;
+            }
 
-        default:
-        {
-            s << "(unknown)";
-            break;
+            default:
+            {
+                const CompressionCodec* codec = findCompressionCodec(compress);
+                if (codec)
+                {
+                    s << "(compressed with " << codec->name() << "; compress response, if any)";
+                }
+                else
+                {
+                    s << "(unknown)";
+                }
+                break;
+            }
         }
     }
 
@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Transceiver.h"
+#include "Ice/Buffer.h"
 
 using namespace std;
 using namespace Ice;
@@ -12,3 +13,20 @@ IceInternal::Transceiver::bind()
     assert(false);
     return nullptr;
 }
+
+SocketOperation
+IceInternal::Transceiver::gatherWrite(const vector<Buffer*>& buffers)
+{
+    for (Buffer* buf : buffers)
+    {
+        if (buf->i != buf->b.end())
+        {
+            SocketOperation op = write(*buf);
+            if (op != SocketOperationNone)
+            {
+                return op;
+            }
+        }
+    }
+    return SocketOperationNone;
+}
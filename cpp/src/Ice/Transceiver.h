@@ -8,6 +8,8 @@
 #include "Network.h"
 #include "TransceiverF.h"
 
+#include <vector>
+
 namespace IceInternal
 {
     class Buffer;
@@ -25,6 +27,12 @@ namespace IceInternal
         virtual SocketOperation write(Buffer&) = 0;
         virtual SocketOperation read(Buffer&) = 0;
 
+        /// @brief Writes the given buffers in order, with a single gather write if the transport supports it.
+        /// The default implementation writes the buffers one at a time with write.
+        /// @return SocketOperationNone if all the buffers are fully written, otherwise the socket operation to wait
+        /// for before writing the remainder.
+        virtual SocketOperation gatherWrite(const std::vector<Buffer*>&);
+
 #if defined(ICE_USE_IOCP)
         virtual bool startWrite(Buffer&) = 0;
         virtual void finishWrite(Buffer&) = 0;
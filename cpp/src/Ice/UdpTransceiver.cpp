@@ -201,6 +201,98 @@ repeat:
     return SocketOperationNone;
 }
 
+#if defined(ICE_USE_MMSG)
+SocketOperation
+IceInternal::UdpTransceiver::gatherWrite(const vector<Buffer*>& buffers)
+{
+    if (_batchSize <= 1)
+    {
+        return Transceiver::gatherWrite(buffers);
+    }
+    assert(_fd != INVALID_SOCKET && _state >= StateConnected);
+
+    sockaddr* peerAddr = nullptr;
+    socklen_t peerAddrLen = 0;
+    if (_state != StateConnected)
+    {
+        if (_peerAddr.saStorage.ss_family == AF_INET)
+        {
+            peerAddrLen = static_cast<socklen_t>(sizeof(sockaddr_in));
+        }
+        else if (_peerAddr.saStorage.ss_family == AF_INET6)
+        {
+            peerAddrLen = static_cast<socklen_t>(sizeof(sockaddr_in6));
+        }
+        else
+        {
+            // No peer has sent a datagram yet.
+            throw SocketException(__FILE__, __LINE__, 0);
+        }
+        peerAddr = &_peerAddr.sa;
+    }
+
+    //
+    // Each buffer is a datagram, send them with as few sendmmsg calls as possible. A datagram is either sent
+    // entirely or not at all.
+    //
+    size_t sent = 0;
+    while (sent < buffers.size())
+    {
+        const size_t count = min(buffers.size() - sent, _batchSize);
+        for (size_t k = 0; k < count; ++k)
+        {
+            Buffer* buf = buffers[sent + k];
+            assert(buf->i == buf->b.begin());
+
+            // The caller is supposed to check the send size before by calling checkSendSize
+            assert(min(_maxPacketSize, _sndSize - _udpOverhead) >= static_cast<int>(buf->b.size()));
+
+            _writeIovecs[k].iov_base = buf->b.begin();
+            _writeIovecs[k].iov_len = buf->b.size();
+
+            msghdr& hdr = _writeHeaders[k].msg_hdr;
+            hdr = msghdr();
+            hdr.msg_name = peerAddr;
+            hdr.msg_namelen = peerAddrLen;
+            hdr.msg_iov = &_writeIovecs[k];
+            hdr.msg_iovlen = 1;
+        }
+
+    repeat:
+
+        int ret = ::sendmmsg(_fd, _writeHeaders.data(), static_cast<unsigned int>(count), 0);
+        if (ret == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                goto repeat;
+            }
+
+            if (wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            throw SocketException(__FILE__, __LINE__, getSocketErrno());
+        }
+
+        for (size_t k = 0; k < static_cast<size_t>(ret); ++k)
+        {
+            assert(_writeHeaders[k].msg_len == buffers[sent + k]->b.size());
+            buffers[sent + k]->i = buffers[sent + k]->b.end();
+        }
+        sent += static_cast<size_t>(ret);
+
+        if (static_cast<size_t>(ret) < count)
+        {
+            // The socket send buffer is full, wait for the socket to be writable to send the remaining datagrams.
+            return SocketOperationWrite;
+        }
+    }
+    return SocketOperationNone;
+}
+#endif
+
 SocketOperation
 IceInternal::UdpTransceiver::read(Buffer& buf)
 {
@@ -211,6 +303,13 @@ IceInternal::UdpTransceiver::read(Buffer& buf)
     assert(buf.i == buf.b.begin());
     assert(_fd != INVALID_SOCKET);
 
+#if defined(ICE_USE_MMSG)
+    if (_batchSize > 1)
+    {
+        return readBatch(buf);
+    }
+#endif
+
 #ifdef _WIN32
     int packetSize = min(_maxPacketSize, _rcvSize - _udpOverhead);
 #else
@@ -286,6 +385,93 @@ repeat:
     return SocketOperationNone;
 }
 
+#if defined(ICE_USE_MMSG)
+SocketOperation
+IceInternal::UdpTransceiver::readBatch(Buffer& buf)
+{
+    if (_readNext == _readCount)
+    {
+        //
+        // All the datagrams from the previous recvmmsg call were returned, receive a new batch.
+        //
+        const auto packetSize = static_cast<size_t>(min(_maxPacketSize, _rcvSize - _udpOverhead));
+        for (size_t k = 0; k < _batchSize; ++k)
+        {
+            _readBuffers[k].resize(packetSize);
+            _readIovecs[k].iov_base = _readBuffers[k].begin();
+            _readIovecs[k].iov_len = packetSize;
+
+            msghdr& hdr = _readHeaders[k].msg_hdr;
+            hdr = msghdr();
+            hdr.msg_iov = &_readIovecs[k];
+            hdr.msg_iovlen = 1;
+            if (_state != StateConnected)
+            {
+                assert(_incoming);
+                hdr.msg_name = &_readAddrs[k].saStorage;
+                hdr.msg_namelen = static_cast<socklen_t>(sizeof(sockaddr_storage));
+            }
+        }
+
+    repeat:
+
+        int ret = ::recvmmsg(_fd, _readHeaders.data(), static_cast<unsigned int>(_batchSize), 0, nullptr);
+        if (ret == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                goto repeat;
+            }
+
+            if (wouldBlock())
+            {
+                return SocketOperationRead;
+            }
+
+            if (connectionLost())
+            {
+                throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        _readNext = 0;
+        _readCount = static_cast<size_t>(ret);
+        if (_readCount > 1)
+        {
+            // Tell the thread pool that more datagrams are available without waiting for the selector.
+            ready(SocketOperationRead, true);
+        }
+    }
+
+    // Client connections are connected at this point, and server connections are never connected.
+    assert(_state != StateNeedConnect);
+
+    //
+    // Return the next datagram by swapping its memory with the buffer. If the datagram was truncated, msg_len is the
+    // size of the whole buffer and the truncation is detected at the connection level when the Ice message size is
+    // checked against the buffer size.
+    //
+    const size_t k = _readNext++;
+    if (_state != StateConnected)
+    {
+        _peerAddr = _readAddrs[k];
+    }
+    buf.b.swap(_readBuffers[k]);
+    buf.b.resize(_readHeaders[k].msg_len);
+    buf.i = buf.b.end();
+
+    if (_readNext == _readCount && _readCount > 1)
+    {
+        ready(SocketOperationRead, false);
+    }
+    return SocketOperationNone;
+}
+#endif
+
 #if defined(ICE_USE_IOCP)
 bool
 IceInternal::UdpTransceiver::startWrite(Buffer& buf)
@@ -612,6 +798,9 @@ IceInternal::UdpTransceiver::UdpTransceiver(
 {
     _fd = createSocket(true, _addr);
     setBufSize(-1, -1);
+#if defined(ICE_USE_MMSG)
+    setBatchSize();
+#endif
     setBlock(_fd, false);
 
     _mcastAddr.saStorage.ss_family = AF_UNSPEC;
@@ -680,6 +869,9 @@ IceInternal::UdpTransceiver::UdpTransceiver(
 {
     _fd = createServerSocket(true, _addr, instance->protocolSupport());
     setBufSize(-1, -1);
+#if defined(ICE_USE_MMSG)
+    setBatchSize();
+#endif
     setBlock(_fd, false);
 
     memset(&_mcastAddr.saStorage, 0, sizeof(sockaddr_storage));
@@ -798,6 +990,42 @@ IceInternal::UdpTransceiver::setBufSize(int rcvSize, int sndSize)
     }
 }
 
+#if defined(ICE_USE_MMSG)
+//
+// Set the maximum number of datagrams received or sent with a single system call.
+//
+void
+IceInternal::UdpTransceiver::setBatchSize()
+{
+    //
+    // The batch size is limited by the maximum number of messages accepted by recvmmsg and sendmmsg (UIO_MAXIOV).
+    // Each datagram of a receive batch has its own buffer, large enough for the largest datagram.
+    //
+    const int maxBatchSize = 1024;
+    int batchSize = _instance->properties()->getIcePropertyAsInt("Ice.UDP.BatchSize");
+    if (batchSize < 1 || batchSize > maxBatchSize)
+    {
+        int adjusted = batchSize < 1 ? 1 : maxBatchSize;
+        Warning out(_instance->logger());
+        out << "Invalid Ice.UDP.BatchSize value of " << batchSize << " adjusted to " << adjusted;
+        batchSize = adjusted;
+    }
+
+    _batchSize = static_cast<size_t>(batchSize);
+    _readNext = 0;
+    _readCount = 0;
+    if (_batchSize > 1)
+    {
+        _readBuffers.resize(_batchSize);
+        _readAddrs.resize(_batchSize);
+        _readIovecs.resize(_batchSize);
+        _readHeaders.resize(_batchSize);
+        _writeIovecs.resize(_batchSize);
+        _writeHeaders.resize(_batchSize);
+    }
+}
+#endif
+
 //
 // The maximum IP datagram size is 65535. Subtract 20 bytes for the IP header and 8 bytes for the UDP header
 // to get the maximum payload.
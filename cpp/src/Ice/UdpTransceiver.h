@@ -3,10 +3,13 @@
 #ifndef ICE_UDP_TRANSCEIVER_H
 #define ICE_UDP_TRANSCEIVER_H
 
+#include "Ice/Buffer.h"
 #include "Network.h"
 #include "ProtocolInstanceF.h"
 #include "Transceiver.h"
 
+#include <vector>
+
 namespace IceInternal
 {
     class UdpEndpoint;
@@ -39,6 +42,9 @@ namespace IceInternal
         void close() final;
         EndpointIPtr bind() final;
         SocketOperation write(Buffer&) final;
+#if defined(ICE_USE_MMSG)
+        SocketOperation gatherWrite(const std::vector<Buffer*>&) final;
+#endif
         SocketOperation read(Buffer&) final;
 #if defined(ICE_USE_IOCP)
         bool startWrite(Buffer&) final;
@@ -58,6 +64,10 @@ namespace IceInternal
 
     private:
         void setBufSize(int, int);
+#if defined(ICE_USE_MMSG)
+        void setBatchSize();
+        SocketOperation readBatch(Buffer&);
+#endif
 
         UdpEndpointIPtr _endpoint;
         const ProtocolInstancePtr _instance;
@@ -79,6 +89,23 @@ namespace IceInternal
         static const int _udpOverhead;
         static const int _maxPacketSize;
 
+#if defined(ICE_USE_MMSG)
+        //
+        // The maximum number of datagrams received or sent with a single system call (Ice.UDP.BatchSize). The
+        // datagrams received with recvmmsg are returned one at a time by read(), _readNext is the index of the next
+        // datagram to return and _readCount the number of datagrams received.
+        //
+        size_t _batchSize;
+        std::vector<Buffer::Container> _readBuffers;
+        std::vector<Address> _readAddrs;
+        std::vector<iovec> _readIovecs;
+        std::vector<mmsghdr> _readHeaders;
+        size_t _readNext;
+        size_t _readCount;
+        std::vector<iovec> _writeIovecs;
+        std::vector<mmsghdr> _writeHeaders;
+#endif
+
 #if defined(ICE_USE_IOCP)
         AsyncInfo _read;
         AsyncInfo _write;
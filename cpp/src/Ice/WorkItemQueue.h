@@ -0,0 +1,211 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_WORK_ITEM_QUEUE_H
+#define ICE_WORK_ITEM_QUEUE_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace IceInternal
+{
+    class ThreadPoolCurrent;
+
+    // A move-only callable that takes a ThreadPoolCurrent. Unlike std::function, small callables such as the lambdas
+    // queued by the thread pool are stored inline and don't require a memory allocation.
+    class WorkItem
+    {
+    public:
+        WorkItem() noexcept = default;
+
+        template<typename F, std::enable_if_t<!std::is_same_v<std::decay_t<F>, WorkItem>, int> = 0>
+        WorkItem(F&& f) // NOLINT(google-explicit-constructor)
+        {
+            using T = std::decay_t<F>;
+            if constexpr (
+                sizeof(T) <= InlineSize && alignof(T) <= alignof(std::max_align_t) &&
+                std::is_nothrow_move_constructible_v<T>)
+            {
+                new (&_storage) T(std::forward<F>(f));
+                _ops = &inlineOps<T>;
+            }
+            else
+            {
+                *reinterpret_cast<T**>(&_storage) = new T(std::forward<F>(f));
+                _ops = &heapOps<T>;
+            }
+        }
+
+        WorkItem(WorkItem&& other) noexcept { moveFrom(other); }
+
+        WorkItem& operator=(WorkItem&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        WorkItem(const WorkItem&) = delete;
+        WorkItem& operator=(const WorkItem&) = delete;
+
+        ~WorkItem() { reset(); }
+
+        explicit operator bool() const noexcept { return _ops != nullptr; }
+
+        void operator()(ThreadPoolCurrent& current)
+        {
+            assert(_ops);
+            _ops->invoke(&_storage, current);
+        }
+
+        void reset() noexcept
+        {
+            if (_ops)
+            {
+                _ops->destroy(&_storage);
+                _ops = nullptr;
+            }
+        }
+
+    private:
+        static constexpr std::size_t InlineSize = 8 * sizeof(void*);
+
+        struct Ops
+        {
+            void (*invoke)(void*, ThreadPoolCurrent&);
+            void (*move)(void*, void*) noexcept;
+            void (*destroy)(void*) noexcept;
+        };
+
+        template<typename T>
+        static constexpr Ops inlineOps{
+            [](void* p, ThreadPoolCurrent& current) { (*static_cast<T*>(p))(current); },
+            [](void* to, void* from) noexcept
+            {
+                new (to) T(std::move(*static_cast<T*>(from)));
+                static_cast<T*>(from)->~T();
+            },
+            [](void* p) noexcept { static_cast<T*>(p)->~T(); }};
+
+        template<typename T>
+        static constexpr Ops heapOps{
+            [](void* p, ThreadPoolCurrent& current) { (**static_cast<T**>(p))(current); },
+            [](void* to, void* from) noexcept { *static_cast<T**>(to) = *static_cast<T**>(from); },
+            [](void* p) noexcept { delete *static_cast<T**>(p); }};
+
+        void moveFrom(WorkItem& other) noexcept
+        {
+            if (other._ops)
+            {
+                other._ops->move(&_storage, &other._storage);
+                _ops = other._ops;
+                other._ops = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) std::byte _storage[InlineSize];
+        const Ops* _ops{nullptr};
+    };
+
+    // A bounded multi-producer multi-consumer FIFO queue of work items. Each cell carries a sequence number that tells
+    // producers and consumers whether the cell is free or holds an item, so pushing and popping only require a
+    // compare-and-swap on the enqueue or dequeue position (see Dmitry Vyukov's bounded MPMC queue).
+    class WorkItemQueue
+    {
+    public:
+        // The capacity must be a power of 2.
+        explicit WorkItemQueue(std::size_t capacity) : _mask(capacity - 1), _cells(new Cell[capacity])
+        {
+            assert(capacity >= 2 && (capacity & _mask) == 0);
+            for (std::size_t i = 0; i < capacity; ++i)
+            {
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        // Moves the item into the queue. Returns false, and leaves the item untouched, if the queue is full.
+        bool tryPush(WorkItem& item) noexcept
+        {
+            Cell* cell;
+            std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                cell = &_cells[pos & _mask];
+                std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0)
+                {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // Full
+                }
+                else
+                {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            cell->item = std::move(item);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Moves the oldest item of the queue into item. Returns false if the queue is empty.
+        bool tryPop(WorkItem& item) noexcept
+        {
+            Cell* cell;
+            std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                cell = &_cells[pos & _mask];
+                std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // Empty
+                }
+                else
+                {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            item = std::move(cell->item);
+            cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<std::size_t> sequence;
+            WorkItem item;
+        };
+
+        const std::size_t _mask;
+        const std::unique_ptr<Cell[]> _cells;
+
+        // Keep the producer and consumer positions on separate cache lines.
+        alignas(64) std::atomic<std::size_t> _enqueuePos{0};
+        alignas(64) std::atomic<std::size_t> _dequeuePos{0};
+    };
+}
+
+#endif
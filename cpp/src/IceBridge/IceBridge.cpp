@@ -1,6 +1,8 @@
 // Copyright (c) ZeroC, Inc.
 
+#include "../Ice/ForwardAsync.h"
 #include "../Ice/Options.h"
+#include "Ice/AsyncResponseHandler.h"
 #include "Ice/Connection.h"
 #include "Ice/ObjectAdapter.h"
 #include "Ice/Router.h"
@@ -21,19 +23,17 @@ namespace
     struct QueuedDispatch final
     {
         //
-        // The pointers in p refer to the Ice marshaling buffer and won't remain valid after
-        // ice_invokeAsync completes, so we have to make a copy of the in parameters
+        // The incoming request refers to the Ice marshaling buffer and won't remain valid after
+        // dispatch completes, so we have to make a copy of the in parameters and of the current
         //
-        QueuedDispatch(
-            pair<const byte*, const byte*> p,
-            function<void(bool, pair<const byte*, const byte*>)>&& r,
-            function<void(exception_ptr)>&& e,
-            Current c)
-            : inParams(p.first, p.second),
-              response(std::move(r)),
-              error(std::move(e)),
-              current(std::move(c))
+        QueuedDispatch(IncomingRequest& request, function<void(OutgoingResponse)> sendResponse)
+            : responseHandler(
+                  make_shared<IceInternal::AsyncResponseHandler>(std::move(sendResponse), request.current()))
         {
+            const byte* encaps;
+            int32_t sz;
+            request.inputStream().readEncapsulation(encaps, sz);
+            inParams.assign(encaps, encaps + sz);
         }
 
         QueuedDispatch(QueuedDispatch&&) = default;
@@ -41,10 +41,8 @@ namespace
         // Make sure we don't copy this struct by accident
         QueuedDispatch(const QueuedDispatch&) = delete;
 
-        const vector<byte> inParams;
-        function<void(bool, pair<const byte*, const byte*>)> response;
-        function<void(exception_ptr)> error;
-        const Current current;
+        vector<byte> inParams;
+        shared_ptr<IceInternal::AsyncResponseHandler> responseHandler;
     };
 
     //
@@ -94,19 +92,11 @@ namespace
         void outgoingException(exception_ptr);
 
         void closed(const ConnectionPtr&);
-        void dispatch(
-            pair<const byte*, const byte*>,
-            function<void(bool, pair<const byte*, const byte*>)>,
-            function<void(exception_ptr)>,
-            const Current&);
+        void dispatch(IncomingRequest&, function<void(OutgoingResponse)>);
 
     private:
-        void send(
-            const ConnectionPtr&,
-            pair<const byte*, const byte*>,
-            function<void(bool, pair<const byte*, const byte*>)>,
-            function<void(exception_ptr)>,
-            const Current& current);
+        void send(const ConnectionPtr&, IncomingRequest&, function<void(OutgoingResponse)>);
+        void send(const ConnectionPtr&, const QueuedDispatch&);
 
         const ObjectAdapterPtr _adapter;
         const ObjectPrx _target;
@@ -128,16 +118,12 @@ namespace
     //
     // The main bridge servant.
     //
-    class BridgeI final : public Ice::BlobjectArrayAsync, public enable_shared_from_this<BridgeI>
+    class BridgeI final : public Ice::Object, public enable_shared_from_this<BridgeI>
     {
     public:
         BridgeI(ObjectAdapterPtr adapter, ObjectPrx target);
 
-        void ice_invokeAsync(
-            pair<const byte*, const byte*> inEncaps,
-            function<void(bool, pair<const byte*, const byte*>)> response,
-            function<void(exception_ptr)> error,
-            const Current& current) final;
+        void dispatch(IncomingRequest&, function<void(OutgoingResponse)>) final;
 
         void closed(const ConnectionPtr&);
         void outgoingSuccess(const shared_ptr<BridgeConnection>&, ConnectionPtr);
@@ -195,10 +181,9 @@ BridgeConnection::outgoingSuccess(ConnectionPtr outgoing)
     //
     // Flush any queued dispatches
     //
-    for (auto& dispatch : _queue)
+    for (const auto& dispatch : _queue)
     {
-        auto inParams = make_pair(dispatch.inParams.data(), dispatch.inParams.data() + dispatch.inParams.size());
-        send(_outgoing, inParams, std::move(dispatch.response), std::move(dispatch.error), dispatch.current);
+        send(_outgoing, dispatch);
     }
     _queue.clear();
 }
@@ -228,7 +213,7 @@ BridgeConnection::outgoingException(exception_ptr ex)
     //
     for (const auto& p : _queue)
     {
-        p.error(ex);
+        p.responseHandler->sendException(ex);
     }
     _queue.clear();
 }
@@ -270,27 +255,24 @@ BridgeConnection::closed(const ConnectionPtr& con)
     //
     for (const auto& p : _queue)
     {
-        p.error(_exception);
+        p.responseHandler->sendException(_exception);
     }
     _queue.clear();
 }
 
 void
-BridgeConnection::dispatch(
-    pair<const byte*, const byte*> inParams,
-    function<void(bool, pair<const byte*, const byte*>)> response,
-    function<void(exception_ptr)> error,
-    const Current& current)
+BridgeConnection::dispatch(IncomingRequest& request, function<void(OutgoingResponse)> sendResponse)
 {
     //
     // We've received an invocation, either from the client via the incoming connection, or from
     // the server via the outgoing (bidirectional) connection. The current.con member tells us
     // the connection over which the request arrived.
     //
+    const Current& current = request.current();
     lock_guard<mutex> lg(_lock);
     if (_exception)
     {
-        error(_exception);
+        sendResponse(makeOutgoingResponse(_exception, current));
     }
     else if (!_outgoing)
     {
@@ -298,33 +280,50 @@ BridgeConnection::dispatch(
         // Queue the invocation until the outgoing connection is established.
         //
         assert(current.con == _incoming);
-        _queue.emplace_back(inParams, std::move(response), std::move(error), current);
+        _queue.emplace_back(request, std::move(sendResponse));
     }
     else
     {
-        send(
-            current.con == _incoming ? _outgoing : _incoming,
-            inParams,
-            std::move(response),
-            std::move(error),
-            current);
+        send(current.con == _incoming ? _outgoing : _incoming, request, std::move(sendResponse));
     }
 }
 
 void
 BridgeConnection::send(
     const ConnectionPtr& dest,
-    pair<const byte*, const byte*> inParams,
-    function<void(bool, pair<const byte*, const byte*>)> response,
-    function<void(exception_ptr)> error, // NOLINT(performance-unnecessary-value-param)
-    const Current& current)
+    IncomingRequest& request,
+    function<void(OutgoingResponse)> sendResponse)
+{
+    const Current& current = request.current();
+
+    //
+    // Create a proxy having the same identity as the request.
+    //
+    auto prx = dest->createProxy(current.id);
+    if (!current.requestId && prx->ice_isTwoway())
+    {
+        // Oneway request
+        prx = prx->ice_oneway();
+    }
+
+    //
+    // The request is forwarded without copying its encapsulation when possible.
+    //
+    IceInternal::forwardAsync(prx, request, std::move(sendResponse), current.ctx);
+}
+
+void
+BridgeConnection::send(const ConnectionPtr& dest, const QueuedDispatch& dispatch)
 {
+    auto responseHandler = dispatch.responseHandler;
+    const Current& current = responseHandler->current();
     try
     {
         //
         // Create a proxy having the same identity as the request.
         //
         auto prx = dest->createProxy(current.id);
+        auto inParams = make_pair(dispatch.inParams.data(), dispatch.inParams.data() + dispatch.inParams.size());
 
         if (!current.requestId)
         {
@@ -338,8 +337,8 @@ BridgeConnection::send(
                 current.mode,
                 inParams,
                 nullptr,
-                error,
-                [response = std::move(response)](bool) { response(true, {nullptr, nullptr}); },
+                [responseHandler](exception_ptr ex) { responseHandler->sendException(ex); },
+                [responseHandler](bool) { responseHandler->sendEmptyResponse(); },
                 current.ctx);
         }
         else
@@ -349,16 +348,16 @@ BridgeConnection::send(
                 current.operation,
                 current.mode,
                 inParams,
-                std::move(response),
-                error,
+                [responseHandler](bool ok, pair<const byte*, const byte*> outParams)
+                { responseHandler->sendResponse(ok, outParams); },
+                [responseHandler](exception_ptr ex) { responseHandler->sendException(ex); },
                 nullptr,
                 current.ctx);
         }
     }
     catch (const std::exception&)
     {
-        // can't move error parameter above since we need it here
-        error(current_exception());
+        responseHandler->sendException(current_exception());
     }
 }
 
@@ -367,12 +366,9 @@ BridgeI::BridgeI(ObjectAdapterPtr adapter, ObjectPrx target) : _adapter(std::mov
 }
 
 void
-BridgeI::ice_invokeAsync(
-    pair<const byte*, const byte*> inParams,
-    function<void(bool, pair<const byte*, const byte*>)> response,
-    function<void(exception_ptr)> error,
-    const Current& current)
+BridgeI::dispatch(IncomingRequest& request, function<void(OutgoingResponse)> sendResponse)
 {
+    const Current& current = request.current();
     shared_ptr<BridgeConnection> bc;
     {
         lock_guard<mutex> lg(_lock);
@@ -424,7 +420,7 @@ BridgeI::ice_invokeAsync(
             }
             catch (const std::exception&)
             {
-                error(current_exception());
+                sendResponse(makeOutgoingResponse(current_exception(), current));
                 return;
             }
         }
@@ -437,7 +433,7 @@ BridgeI::ice_invokeAsync(
     //
     // Delegate the invocation to the BridgeConnection object.
     //
-    bc->dispatch(inParams, std::move(response), std::move(error), current);
+    bc->dispatch(request, std::move(sendResponse));
 }
 
 void
@@ -784,6 +784,27 @@ ReplicaGroupEntry::getLeastLoadedNodeLoad(LoadSample loadSample) const
     }
 }
 
+set<string>
+ReplicaGroupEntry::getNodeNames() const
+{
+    vector<shared_ptr<ServerAdapterEntry>> replicas;
+    {
+        lock_guard lock(_mutex);
+        replicas = _replicas;
+    }
+
+    set<string> nodes;
+    for (const auto& replica : replicas)
+    {
+        string node = replica->getNodeName();
+        if (!node.empty())
+        {
+            nodes.insert(std::move(node));
+        }
+    }
+    return nodes;
+}
+
 AdapterInfoSeq
 ReplicaGroupEntry::getAdapterInfoNoEndpoints() const
 {
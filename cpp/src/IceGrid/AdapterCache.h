@@ -130,6 +130,7 @@ namespace IceGrid
 
         void update(const std::string&, const std::shared_ptr<LoadBalancingPolicy>&, const std::string&);
         [[nodiscard]] bool hasAdaptersFromOtherApplications() const;
+        [[nodiscard]] std::set<std::string> getNodeNames() const;
 
         [[nodiscard]] const std::string& getFilter() const { return _filter; }
 
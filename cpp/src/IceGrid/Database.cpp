@@ -519,6 +519,7 @@ Database::syncObjects(const ObjectInfoSeq& objects, int64_t dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            ++_loadIndexSerial;
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1518,6 +1519,7 @@ Database::addObject(const ObjectInfo& info)
             dbSerial = updateSerial(txn, objectsDbName);
 
             txn.commit();
+            invalidateLoadIndexes(info.type);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1567,6 +1569,11 @@ Database::addOrUpdateObject(const ObjectInfo& info, int64_t dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            if (update)
+            {
+                invalidateLoadIndexes(v.type);
+            }
+            invalidateLoadIndexes(info.type);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1621,6 +1628,7 @@ Database::removeObject(const Ice::Identity& id, int64_t dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            invalidateLoadIndexes(info.type);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1672,6 +1680,7 @@ Database::updateObject(Ice::ObjectPrx proxy)
             dbSerial = updateSerial(txn, objectsDbName);
 
             txn.commit();
+            invalidateLoadIndexes(info.type);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1696,6 +1705,7 @@ Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
     try
     {
         IceDB::ReadWriteTxn txn(_env);
+        set<string> types;
         for (const auto& obj : objects)
         {
             Ice::Identity id = obj.proxy->ice_getIdentity();
@@ -1703,10 +1713,16 @@ Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
             if (_objects.get(txn, id, info))
             {
                 _objectsByType.del(txn, info.type, id);
+                types.insert(info.type);
             }
             addObject(txn, obj, false);
+            types.insert(obj.type);
         }
         txn.commit();
+        for (const auto& type : types)
+        {
+            invalidateLoadIndexes(type);
+        }
     }
     catch (const IceDB::LMDBException& ex)
     {
@@ -1724,6 +1740,7 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
     try
     {
         IceDB::ReadWriteTxn txn(_env);
+        set<string> types;
         for (const auto& obj : objects)
         {
             Ice::Identity id = obj.proxy->ice_getIdentity();
@@ -1731,9 +1748,14 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
             if (_objects.get(txn, id, info))
             {
                 deleteObject(txn, info, false);
+                types.insert(info.type);
             }
         }
         txn.commit();
+        for (const auto& type : types)
+        {
+            invalidateLoadIndexes(type);
+        }
     }
     catch (const IceDB::LMDBException& ex)
     {
@@ -1784,35 +1806,73 @@ Database::getObjectByTypeOnLeastLoadedNode(
     const shared_ptr<Ice::Connection>& con,
     const Ice::Context& ctx)
 {
-    Ice::ObjectProxySeq objs = getObjectsByType(type, con, ctx);
-    if (objs.empty())
+    if (con && _pluginFacade->hasTypeFilters() && !_pluginFacade->getTypeFilters(type).empty())
     {
-        return nullopt;
+        //
+        // The type filters select the objects among all the objects of the type, we can't use the load index.
+        //
+        Ice::ObjectProxySeq objs = getObjectsByType(type, con, ctx);
+        if (objs.empty())
+        {
+            return nullopt;
+        }
+
+        IceInternal::shuffle(objs.begin(), objs.end());
+        vector<pair<optional<Ice::ObjectPrx>, float>> objectsWithLoad;
+        objectsWithLoad.reserve(objs.size());
+        for (const auto& obj : objs)
+        {
+            objectsWithLoad.emplace_back(obj, getObjectLoad(*obj, sample));
+        }
+        return min_element(
+                   objectsWithLoad.begin(),
+                   objectsWithLoad.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; })
+            ->first;
     }
 
-    IceInternal::shuffle(objs.begin(), objs.end());
-    vector<pair<optional<Ice::ObjectPrx>, float>> objectsWithLoad;
-    objectsWithLoad.reserve(objs.size());
-    for (const auto& obj : objs)
+    const auto key = make_pair(type, sample);
+    shared_ptr<const LoadIndex> index;
     {
-        float load = 1.0f;
-        if (!obj->ice_getAdapterId().empty())
+        auto indexes = getLoadIndexes();
+        auto p = indexes->find(key);
+        if (p != indexes->end())
         {
-            try
-            {
-                load = _adapterCache.get(obj->ice_getAdapterId())->getLeastLoadedNodeLoad(sample);
-            }
-            catch (const AdapterNotExistException&)
-            {
-            }
+            index = p->second;
+        }
+    }
+
+    if (!index || !isLoadIndexValid(*index))
+    {
+        index = rebuildLoadIndex(key, std::move(index));
+    }
+
+    //
+    // Pick one of the objects from enabled servers with the lowest load. The objects are ordered by load so we only
+    // need to check the first objects of the index.
+    //
+    vector<Ice::ObjectPrx> candidates;
+    float load = 0.0f;
+    for (const auto& [objectLoad, position] : index->byLoad)
+    {
+        if (!candidates.empty() && objectLoad > load)
+        {
+            break;
+        }
+
+        const auto& entry = (*index->objects)[position];
+        if (entry.server.empty() || _nodeObserverTopic->isServerEnabled(entry.server))
+        {
+            load = objectLoad;
+            candidates.push_back(entry.proxy);
         }
-        objectsWithLoad.emplace_back(obj, load);
     }
-    return min_element(
-               objectsWithLoad.begin(),
-               objectsWithLoad.end(),
-               [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; })
-        ->first;
+
+    if (candidates.empty())
+    {
+        return nullopt;
+    }
+    return candidates[IceInternal::random(static_cast<unsigned int>(candidates.size()))];
 }
 
 Ice::ObjectProxySeq
@@ -1974,6 +2034,45 @@ Database::getInternalObjectsByType(const string& type)
     return proxies;
 }
 
+void
+Database::nodeLoadUpdated(const string& node)
+{
+    //
+    // Publish a copy of each index with the objects of this node re-positioned. The copies share the objects with
+    // the published indexes, only the loads are copied. The indexes being built re-position the objects of this node
+    // before they're published.
+    //
+    lock_guard updateLock(_loadIndexUpdateMutex);
+    for (auto& [key, build] : _loadIndexBuilds)
+    {
+        build.nodes.insert(node);
+    }
+
+    auto indexes = getLoadIndexes();
+    shared_ptr<LoadIndexes> updated;
+    for (const auto& [key, index] : *indexes)
+    {
+        if (index->nodeObjects->find(node) == index->nodeObjects->end())
+        {
+            continue;
+        }
+
+        auto copy = make_shared<LoadIndex>(*index);
+        updateLoads(*copy, node, key.second);
+
+        if (!updated)
+        {
+            updated = make_shared<LoadIndexes>(*indexes);
+        }
+        (*updated)[key] = std::move(copy);
+    }
+
+    if (updated)
+    {
+        setLoadIndexes(std::move(updated));
+    }
+}
+
 void
 Database::checkForAddition(const ApplicationHelper& app, const IceDB::ReadWriteTxn& txn)
 {
@@ -2235,6 +2334,8 @@ Database::load(const ApplicationHelper& app, ServerEntrySeq& entries, const stri
     {
         entries.push_back(_serverCache.add(server.second));
     }
+
+    ++_loadIndexSerial;
 }
 
 void
@@ -2260,6 +2361,8 @@ Database::unload(const ApplicationHelper& app, ServerEntrySeq& entries)
     {
         _nodeCache.get(node.first)->removeDescriptor(application);
     }
+
+    ++_loadIndexSerial;
 }
 
 void
@@ -2386,6 +2489,8 @@ Database::reload(
             entries.push_back(_serverCache.add(q.second));
         }
     }
+
+    ++_loadIndexSerial;
 }
 
 int64_t
@@ -2787,6 +2892,217 @@ Database::updateSerial(const IceDB::ReadWriteTxn& txn, const string& dbName, int
     }
 }
 
+float
+Database::getObjectLoad(const Ice::ObjectPrx& proxy, LoadSample sample)
+{
+    if (!proxy->ice_getAdapterId().empty())
+    {
+        try
+        {
+            return _adapterCache.get(proxy->ice_getAdapterId())->getLeastLoadedNodeLoad(sample);
+        }
+        catch (const AdapterNotExistException&)
+        {
+        }
+    }
+    return 1.0f;
+}
+
+bool
+Database::isLoadIndexValid(const LoadIndex& index) const
+{
+    return index.serial == _loadIndexSerial && !*index.invalidated;
+}
+
+shared_ptr<const Database::LoadIndex>
+Database::rebuildLoadIndex(const LoadIndexKey& key, shared_ptr<const LoadIndex> previous)
+{
+    //
+    // Only one query builds the index of a type and load sample at a time. The concurrent queries use the previous
+    // index, or wait for the new index if there's no previous index.
+    //
+    {
+        unique_lock updateLock(_loadIndexUpdateMutex);
+        while (true)
+        {
+            auto indexes = getLoadIndexes();
+            auto p = indexes->find(key);
+            if (p != indexes->end() && isLoadIndexValid(*p->second))
+            {
+                return p->second;
+            }
+            else if (_loadIndexBuilds.emplace(key, LoadIndexBuild{}).second)
+            {
+                break;
+            }
+            else if (previous)
+            {
+                return previous;
+            }
+            _loadIndexBuilt.wait(updateLock);
+        }
+    }
+
+    // Build the index without holding any lock.
+    shared_ptr<LoadIndex> index;
+    try
+    {
+        index = buildLoadIndex(key.first, key.second);
+    }
+    catch (...)
+    {
+        lock_guard updateLock(_loadIndexUpdateMutex);
+        _loadIndexBuilds.erase(key);
+        _loadIndexBuilt.notify_all();
+        throw;
+    }
+
+    lock_guard updateLock(_loadIndexUpdateMutex);
+    auto build = _loadIndexBuilds.find(key);
+    assert(build != _loadIndexBuilds.end());
+
+    // Apply the updates that occurred during the build: the next query rebuilds the index if the objects of the type
+    // were updated, and the objects of the nodes whose load was updated are re-positioned.
+    *index->invalidated = build->second.invalidated;
+    for (const auto& node : build->second.nodes)
+    {
+        updateLoads(*index, node, key.second);
+    }
+    _loadIndexBuilds.erase(build);
+
+    // We don't keep indexes for unknown types.
+    auto indexes = getLoadIndexes();
+    if (!index->objects->empty() || indexes->find(key) != indexes->end())
+    {
+        auto updated = make_shared<LoadIndexes>(*indexes);
+        if (index->objects->empty())
+        {
+            updated->erase(key);
+        }
+        else
+        {
+            (*updated)[key] = index;
+        }
+        setLoadIndexes(std::move(updated));
+    }
+    _loadIndexBuilt.notify_all();
+    return index;
+}
+
+shared_ptr<Database::LoadIndex>
+Database::buildLoadIndex(const string& type, LoadSample sample)
+{
+    auto index = make_shared<LoadIndex>();
+
+    // Read the serial first, if the objects are updated while we build the index, the next query rebuilds it.
+    index->serial = _loadIndexSerial;
+
+    auto objects = make_shared<vector<LoadIndexEntry>>();
+    for (const auto& obj : _objectCache.getObjectsByType(type))
+    {
+        objects->push_back({obj->getProxy(), obj->getServer()});
+    }
+
+    {
+        IceDB::ReadOnlyTxn txn(_env);
+        for (auto& info : findByType(txn, _objects, _objectsByType, type))
+        {
+            objects->push_back({std::move(*info.proxy), string()});
+        }
+    }
+
+    auto nodeObjects = make_shared<multimap<string, size_t>>();
+    index->loads.reserve(objects->size());
+    for (size_t position = 0; position < objects->size(); ++position)
+    {
+        const auto& proxy = (*objects)[position].proxy;
+        float load = 1.0f;
+        if (!proxy->ice_getAdapterId().empty())
+        {
+            try
+            {
+                auto adapter = _adapterCache.get(proxy->ice_getAdapterId());
+                load = adapter->getLeastLoadedNodeLoad(sample);
+                if (auto serverAdapter = dynamic_pointer_cast<ServerAdapterEntry>(adapter))
+                {
+                    nodeObjects->emplace(serverAdapter->getNodeName(), position);
+                }
+                else if (auto replicaGroup = dynamic_pointer_cast<ReplicaGroupEntry>(adapter))
+                {
+                    for (const auto& node : replicaGroup->getNodeNames())
+                    {
+                        nodeObjects->emplace(node, position);
+                    }
+                }
+            }
+            catch (const AdapterNotExistException&)
+            {
+            }
+        }
+        index->loads.push_back(load);
+        index->byLoad.emplace(load, position);
+    }
+
+    index->objects = std::move(objects);
+    index->nodeObjects = std::move(nodeObjects);
+    return index;
+}
+
+void
+Database::updateLoads(LoadIndex& index, const string& node, LoadSample sample)
+{
+    auto range = index.nodeObjects->equal_range(node);
+    for (auto p = range.first; p != range.second; ++p)
+    {
+        const size_t position = p->second;
+        const float load = getObjectLoad((*index.objects)[position].proxy, sample);
+        if (load != index.loads[position])
+        {
+            index.byLoad.erase({index.loads[position], position});
+            index.loads[position] = load;
+            index.byLoad.emplace(load, position);
+        }
+    }
+}
+
+void
+Database::invalidateLoadIndexes(const string& type)
+{
+    //
+    // The published indexes of this type remain in use until a query rebuilds them. The indexes of this type being
+    // built are rebuilt by the next query.
+    //
+    lock_guard updateLock(_loadIndexUpdateMutex);
+    for (auto& [key, build] : _loadIndexBuilds)
+    {
+        if (key.first == type)
+        {
+            build.invalidated = true;
+        }
+    }
+
+    auto indexes = getLoadIndexes();
+    for (auto p = indexes->lower_bound({type, LoadSample{}}); p != indexes->end() && p->first.first == type; ++p)
+    {
+        *p->second->invalidated = true;
+    }
+}
+
+shared_ptr<const Database::LoadIndexes>
+Database::getLoadIndexes()
+{
+    lock_guard lock(_loadIndexesMutex);
+    return _loadIndexes;
+}
+
+void
+Database::setLoadIndexes(shared_ptr<const LoadIndexes> indexes)
+{
+    // Called with _loadIndexUpdateMutex locked.
+    lock_guard lock(_loadIndexesMutex);
+    _loadIndexes = std::move(indexes);
+}
+
 void
 Database::addAdapter(const IceDB::ReadWriteTxn& txn, const AdapterInfo& info)
 {
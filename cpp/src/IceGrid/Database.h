@@ -17,6 +17,9 @@
 #include "ServerCache.h"
 #include "Topics.h"
 
+#include <atomic>
+#include <set>
+
 namespace IceGrid
 {
     class AdminSessionI;
@@ -163,6 +166,9 @@ namespace IceGrid
         void removeInternalObject(const Ice::Identity&);
         Ice::ObjectProxySeq getInternalObjectsByType(const std::string&);
 
+        // Called when the load of a node changes, to update the load of its objects in the load indexes.
+        void nodeLoadUpdated(const std::string&);
+
     private:
         Database(
             const Ice::ObjectAdapterPtr&,
@@ -215,6 +221,53 @@ namespace IceGrid
         void addObject(const IceDB::ReadWriteTxn&, const ObjectInfo&, bool);
         void deleteObject(const IceDB::ReadWriteTxn&, const ObjectInfo&, bool);
 
+        //
+        // The objects of a type ordered by the load of their node for a load sample, used to find the object on the
+        // least loaded node without computing the load of every object. A published index is never modified: after
+        // the objects of its type or the applications are updated, a single query builds a new index without holding
+        // any lock while the other queries keep using the previous index, and a node load update publishes copies of
+        // the indexes with only the objects of this node re-positioned.
+        //
+        struct LoadIndexEntry
+        {
+            Ice::ObjectPrx proxy;
+            std::string server; // Empty if the object isn't a server object.
+        };
+
+        struct LoadIndex
+        {
+            std::uint64_t serial{0}; // The value of _loadIndexSerial when the index was built.
+
+            // Set when the objects of the type are updated, shared by the copies of the index.
+            std::shared_ptr<std::atomic<bool>> invalidated{std::make_shared<std::atomic<bool>>(false)};
+
+            // The objects, and the position of the objects hosted by each node, are shared by the copies of the index.
+            // The objects of a replica group are hosted by each node of the replica group.
+            std::shared_ptr<const std::vector<LoadIndexEntry>> objects;
+            std::shared_ptr<const std::multimap<std::string, std::size_t>> nodeObjects;
+
+            std::vector<float> loads;                       // The load of each object.
+            std::set<std::pair<float, std::size_t>> byLoad; // The objects ordered by load.
+        };
+        using LoadIndexKey = std::pair<std::string, LoadSample>;
+        using LoadIndexes = std::map<LoadIndexKey, std::shared_ptr<const LoadIndex>>;
+
+        // An index being built.
+        struct LoadIndexBuild
+        {
+            bool invalidated{false};     // Set if the objects of the type are updated during the build.
+            std::set<std::string> nodes; // The nodes whose load was updated during the build.
+        };
+
+        float getObjectLoad(const Ice::ObjectPrx&, LoadSample);
+        [[nodiscard]] bool isLoadIndexValid(const LoadIndex&) const;
+        std::shared_ptr<const LoadIndex> rebuildLoadIndex(const LoadIndexKey&, std::shared_ptr<const LoadIndex>);
+        std::shared_ptr<LoadIndex> buildLoadIndex(const std::string&, LoadSample);
+        void updateLoads(LoadIndex&, const std::string&, LoadSample);
+        void invalidateLoadIndexes(const std::string&);
+        std::shared_ptr<const LoadIndexes> getLoadIndexes();
+        void setLoadIndexes(std::shared_ptr<const LoadIndexes>);
+
         friend struct AddComponent;
 
         static const std::string _applicationDbName;
@@ -292,6 +345,16 @@ namespace IceGrid
         };
         std::vector<UpdateInfo> _updating;
 
+        std::shared_ptr<const LoadIndexes> _loadIndexes{std::make_shared<LoadIndexes>()};
+        std::atomic<std::uint64_t> _loadIndexSerial{0}; // Incremented when all the load indexes must be rebuilt.
+        std::mutex _loadIndexesMutex;                    // Only locked to get or set the _loadIndexes pointer.
+        std::mutex _loadIndexUpdateMutex;                // Serializes the updates of the load indexes.
+
+        // The indexes being built, protected by _loadIndexUpdateMutex. The queries without a previous index wait for
+        // _loadIndexBuilt.
+        std::map<LoadIndexKey, LoadIndexBuild> _loadIndexBuilds;
+        std::condition_variable _loadIndexBuilt;
+
         mutable std::mutex _mutex;
         std::condition_variable _condVar;
     };
@@ -33,6 +33,7 @@ NodeSessionI::create(
         ObjectInfo objInfo = {node, string{Node::ice_staticId()}};
         database->addInternalObject(objInfo, true); // Add or update previous node proxy.
         database->getInternalAdapter()->add(nodeSession, nodeSessionId);
+        database->nodeLoadUpdated(info->name);
     }
     catch (const NodeActiveException&)
     {
@@ -77,22 +78,27 @@ NodeSessionI::NodeSessionI(
 void
 NodeSessionI::keepAlive(LoadInfo load, const Ice::Current&)
 {
-    lock_guard lock(_mutex);
-
-    if (_destroy)
     {
-        throw Ice::ObjectNotExistException{__FILE__, __LINE__};
-    }
+        lock_guard lock(_mutex);
 
-    _timestamp = chrono::steady_clock::now();
-    _load = load;
+        if (_destroy)
+        {
+            throw Ice::ObjectNotExistException{__FILE__, __LINE__};
+        }
 
-    if (_traceLevels->node > 2)
-    {
-        Ice::Trace out(_traceLevels->logger, _traceLevels->nodeCat);
-        out << "node '" << _info->name << "' keep alive ";
-        out << "(load = " << _load.avg1 << ", " << _load.avg5 << ", " << _load.avg15 << ")";
+        _timestamp = chrono::steady_clock::now();
+        _load = load;
+
+        if (_traceLevels->node > 2)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->nodeCat);
+            out << "node '" << _info->name << "' keep alive ";
+            out << "(load = " << _load.avg1 << ", " << _load.avg5 << ", " << _load.avg15 << ")";
+        }
     }
+
+    // Must be called without the session mutex locked, the database gets the new load from this session.
+    _database->nodeLoadUpdated(_info->name);
 }
 
 void
@@ -287,6 +293,7 @@ NodeSessionI::destroyImpl(bool shutdown)
     // created.
     //
     _database->getNode(_info->name)->setSession(nullptr);
+    _database->nodeLoadUpdated(_info->name);
 
     if (!shutdown)
     {
@@ -0,0 +1,349 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "EventLog.h"
+#include "Ice/LoggerUtil.h"
+#include "Ice/StringUtil.h"
+#include "TraceLevels.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+using namespace std;
+using namespace IceStorm;
+
+namespace
+{
+    using EventMapROCursor = IceDB::ReadOnlyCursor<EventRecordKey, EventRecord, IceDB::IceContext, Ice::OutputStream>;
+    using EventOffsetMapROCursor = IceDB::ReadOnlyCursor<string, int64_t, IceDB::IceContext, Ice::OutputStream>;
+
+    // The size of an event used for the retention by size.
+    int64_t eventSize(const EventRecord& record)
+    {
+        return static_cast<int64_t>(record.event.op.size() + record.event.data.size());
+    }
+
+    int64_t now()
+    {
+        return chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    int64_t parseQoS(const QoS& qos, const string& name)
+    {
+        auto p = qos.find(name);
+        assert(p != qos.end());
+        istringstream is(IceInternal::trim(p->second));
+        int64_t value;
+        if (!(is >> value) || !is.eof() || value < 0)
+        {
+            throw BadQoS("invalid " + name + " (numeric value required): " + p->second);
+        }
+        return value;
+    }
+}
+
+EventLog::EventLog(
+    const IceDB::Env& env,
+    EventMap eventMap,
+    EventOffsetMap offsetMap,
+    const Ice::PropertiesPtr& properties,
+    shared_ptr<TraceLevels> traceLevels)
+    : _env(env),
+      _eventMap(std::move(eventMap)),
+      _offsetMap(std::move(offsetMap)),
+      _traceLevels(std::move(traceLevels)),
+      _retentionSize(properties->getIcePropertyAsInt("IceStorm.EventLog.RetentionSize")),
+      _retentionTime(properties->getIcePropertyAsInt("IceStorm.EventLog.RetentionTime"))
+{
+    for (const auto& topic : properties->getIcePropertyAsList("IceStorm.EventLog.Topics"))
+    {
+        if (topic == "*")
+        {
+            _allTopics = true;
+        }
+        else
+        {
+            _topics.insert(topic);
+        }
+    }
+
+    //
+    // Restore the offsets and sizes of the event logs from the database.
+    //
+    IceDB::ReadOnlyTxn txn(_env);
+    {
+        EventOffsetMapROCursor cursor(_offsetMap, txn);
+        string topic;
+        int64_t next;
+        while (cursor.get(topic, next, MDB_NEXT))
+        {
+            _next[topic] = next;
+        }
+    }
+
+    EventMapROCursor cursor(_eventMap, txn);
+    EventRecordKey key;
+    EventRecord record;
+    while (cursor.get(key, record, MDB_NEXT))
+    {
+        TopicLog& log = _logs[key.topic];
+        if (log.count == 0)
+        {
+            log.first = key.offset;
+        }
+        ++log.count;
+        log.size += eventSize(record);
+        int64_t& next = _next[key.topic];
+        next = max(next, key.offset + 1);
+    }
+
+    if (_traceLevels->topicMgr > 0)
+    {
+        for (const auto& [topic, log] : _logs)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->topicMgrCat);
+            out << "restored event log of topic `" << topic << "': " << log.count << " events from offset "
+                << log.first;
+        }
+    }
+}
+
+optional<EventLog::ReplayPosition>
+EventLog::getReplayPosition(const QoS& qos)
+{
+    optional<ReplayPosition> position;
+    if (qos.find("replayFromOffset") != qos.end())
+    {
+        position = ReplayPosition{};
+        position->offset = parseQoS(qos, "replayFromOffset");
+    }
+    if (qos.find("replayFromTime") != qos.end())
+    {
+        if (!position)
+        {
+            position = ReplayPosition{};
+        }
+        position->timestamp = parseQoS(qos, "replayFromTime");
+    }
+    return position;
+}
+
+bool
+EventLog::isLogged(const string& topic) const
+{
+    // Immutable
+    return _allTopics || _topics.find(topic) != _topics.end();
+}
+
+void
+EventLog::append(const string& topic, EventDataSeq& events)
+{
+    const int64_t timestamp = now();
+
+    lock_guard lock(_mutex);
+    int64_t& next = _next[topic];
+    for (auto& event : events)
+    {
+        event.context[eventOffsetContextKey] = to_string(next);
+        _pending.emplace_back(EventRecordKey{topic, next}, EventRecord{timestamp, event});
+        ++next;
+    }
+    _appended += events.size();
+}
+
+void
+EventLog::sync()
+{
+    uint64_t target;
+    {
+        lock_guard lock(_mutex);
+        target = _appended;
+        if (_written >= target)
+        {
+            return;
+        }
+    }
+
+    //
+    // Only one thread writes at a time: the thread that gets the write mutex writes the events queued by all the
+    // threads waiting for it, which are then done when they get the mutex.
+    //
+    lock_guard writeLock(_writeMutex);
+    vector<pair<EventRecordKey, EventRecord>> events;
+    {
+        lock_guard lock(_mutex);
+        if (_written >= target)
+        {
+            return;
+        }
+        events.swap(_pending);
+    }
+
+    try
+    {
+        write(events);
+    }
+    catch (const std::exception& ex)
+    {
+        // The events are still delivered to the subscribers, but they can't be replayed.
+        Ice::Error out(_traceLevels->logger);
+        out << "unable to write " << events.size() << " events to the event log:\n" << ex;
+    }
+
+    lock_guard lock(_mutex);
+    _written += events.size();
+}
+
+EventDataSeq
+EventLog::replay(const string& topic, ReplayPosition& position, size_t maxEvents)
+{
+    // Write the events queued before this call, they must be replayed.
+    sync();
+
+    lock_guard writeLock(_writeMutex);
+    EventDataSeq events;
+    auto p = _logs.find(topic);
+    if (p == _logs.end() || p->second.count == 0)
+    {
+        return events;
+    }
+
+    const int64_t cutoff = max(retentionCutoff(), position.timestamp);
+    EventRecordKey key{topic, max(position.offset, p->second.first)};
+    if (key.offset >= p->second.first + p->second.count)
+    {
+        return events;
+    }
+
+    IceDB::ReadOnlyTxn txn(_env);
+    EventMapROCursor cursor(_eventMap, txn);
+    EventRecord record;
+    if (cursor.find(key, record))
+    {
+        do
+        {
+            if (key.topic != topic)
+            {
+                break;
+            }
+            position.offset = key.offset + 1;
+            if (record.timestamp >= cutoff)
+            {
+                events.push_back(std::move(record.event));
+                if (events.size() == maxEvents)
+                {
+                    break;
+                }
+            }
+        } while (cursor.get(key, record, MDB_NEXT));
+    }
+    return events;
+}
+
+void
+EventLog::destroy(const string& topic)
+{
+    sync();
+
+    lock_guard writeLock(_writeMutex);
+    {
+        lock_guard lock(_mutex);
+        _next.erase(topic);
+    }
+
+    // Remove the events and the next offset of the topic: a topic created later with the same name starts at offset 0.
+    IceDB::ReadWriteTxn txn(_env);
+    auto p = _logs.find(topic);
+    if (p != _logs.end())
+    {
+        for (int64_t offset = p->second.first; offset < p->second.first + p->second.count; ++offset)
+        {
+            _eventMap.del(txn, EventRecordKey{topic, offset});
+        }
+    }
+    _offsetMap.del(txn, topic);
+    txn.commit();
+
+    if (p != _logs.end())
+    {
+        _logs.erase(p);
+    }
+}
+
+void
+EventLog::write(const vector<pair<EventRecordKey, EventRecord>>& events)
+{
+    // Called with _writeMutex locked. The logs are only updated once the transaction is committed.
+    map<string, TopicLog> logs;
+    map<string, int64_t> next;
+
+    IceDB::ReadWriteTxn txn(_env);
+    for (const auto& [key, record] : events)
+    {
+        _eventMap.put(txn, key, record);
+        next[key.topic] = key.offset + 1;
+
+        auto p = logs.find(key.topic);
+        if (p == logs.end())
+        {
+            auto q = _logs.find(key.topic);
+            p = logs.emplace(key.topic, q == _logs.end() ? TopicLog{} : q->second).first;
+        }
+        if (p->second.count == 0)
+        {
+            p->second.first = key.offset;
+        }
+        ++p->second.count;
+        p->second.size += eventSize(record);
+    }
+
+    for (const auto& [topic, offset] : next)
+    {
+        _offsetMap.put(txn, topic, offset);
+    }
+
+    //
+    // Remove the oldest events of the topics that exceed the retention size or time. The retention time is only
+    // enforced when new events are written to the topic, replay skips the expired events that are still stored.
+    //
+    const int64_t cutoff = retentionCutoff();
+    for (auto& [topic, log] : logs)
+    {
+        while (log.count > 0)
+        {
+            EventRecordKey key{topic, log.first};
+            EventRecord record;
+            if (!_eventMap.get(txn, key, record))
+            {
+                break;
+            }
+
+            if ((_retentionSize <= 0 || log.size <= _retentionSize) && record.timestamp >= cutoff)
+            {
+                break;
+            }
+
+            _eventMap.del(txn, key);
+            --log.count;
+            log.size -= eventSize(record);
+            ++log.first;
+        }
+    }
+
+    txn.commit();
+
+    for (auto& [topic, log] : logs)
+    {
+        _logs[topic] = log;
+    }
+}
+
+int64_t
+EventLog::retentionCutoff() const
+{
+    if (_retentionTime <= chrono::seconds::zero())
+    {
+        return 0;
+    }
+    return now() - chrono::duration_cast<chrono::milliseconds>(_retentionTime).count();
+}
@@ -0,0 +1,96 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICESTORM_EVENT_LOG_H
+#define ICESTORM_EVENT_LOG_H
+
+#include "IceStormInternal.h"
+#include "Util.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+
+namespace IceStorm
+{
+    class TraceLevels;
+
+    // The context entry set on the events of a topic with an event log. Its value is the offset of the event.
+    const char* const eventOffsetContextKey = "IceStorm.Offset";
+
+    //
+    // The append-only event log of the topics configured with IceStorm.EventLog.Topics. The events are stored in the
+    // LMDB database of the IceStorm service with an offset that increases by one for each event of a topic. The next
+    // offset of each topic is stored too, so that the offsets don't restart at 0 when the retention removed all the
+    // events of a topic. A subscriber can ask to receive the events logged before it subscribes with the
+    // replayFromOffset and replayFromTime QoS.
+    //
+    class EventLog
+    {
+    public:
+        // The position of the first event to replay, from the subscriber QoS.
+        struct ReplayPosition
+        {
+            std::int64_t offset{0};
+            std::int64_t timestamp{0}; // In milliseconds since the Unix epoch.
+        };
+
+        EventLog(const IceDB::Env&, EventMap, EventOffsetMap, const Ice::PropertiesPtr&, std::shared_ptr<TraceLevels>);
+
+        // Returns the replay position of the given QoS, or nullopt if the QoS doesn't request a replay. Throws BadQoS
+        // if the replay QoS are invalid.
+        static std::optional<ReplayPosition> getReplayPosition(const QoS&);
+
+        [[nodiscard]] bool isLogged(const std::string&) const;
+
+        // Assigns the next offsets of the topic to the events and queues them for writing. Must be called with the
+        // topic subscribers mutex locked, the offsets are assigned in the order the events are queued to the
+        // subscribers.
+        void append(const std::string&, EventDataSeq&);
+
+        // Writes the queued events to the database. Returns once the events queued before the call are written.
+        void sync();
+
+        // Returns the next logged events of the topic from the given position, at most the given number of events,
+        // and moves the position past them. Returns fewer events than this number once it reaches the end of the log.
+        // The events logged later are returned by the next calls.
+        EventDataSeq replay(const std::string&, ReplayPosition&, std::size_t);
+
+        // Removes the logged events of a destroyed topic.
+        void destroy(const std::string&);
+
+    private:
+        struct TopicLog
+        {
+            std::int64_t first{0};
+            std::int64_t count{0};
+            std::int64_t size{0};
+        };
+
+        void write(const std::vector<std::pair<EventRecordKey, EventRecord>>&);
+        [[nodiscard]] std::int64_t retentionCutoff() const;
+
+        const IceDB::Env& _env;
+        EventMap _eventMap;
+        EventOffsetMap _offsetMap;
+        const std::shared_ptr<TraceLevels> _traceLevels;
+        std::set<std::string> _topics;
+        bool _allTopics{false};
+        const std::int64_t _retentionSize;
+        const std::chrono::seconds _retentionTime;
+
+        // Protects _next, _pending, _appended and _written.
+        std::mutex _mutex;
+        std::map<std::string, std::int64_t> _next; // The offset of the next event of each topic.
+        std::vector<std::pair<EventRecordKey, EventRecord>> _pending;
+        std::uint64_t _appended{0};
+        std::uint64_t _written{0};
+
+        // Serializes the writes to the database, held while writing. Protects _logs.
+        std::mutex _writeMutex;
+        std::map<std::string, TopicLog> _logs; // The offset, number and size of the events stored for each topic.
+    };
+}
+
+#endif
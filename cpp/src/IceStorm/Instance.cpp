@@ -5,10 +5,12 @@
 #include "../Ice/Timer.h"
 #include "../Ice/TraceUtil.h"
 #include "Ice/Communicator.h"
+#include "EventLog.h"
 #include "Ice/Properties.h"
 #include "InstrumentationI.h"
 #include "NodeI.h"
 #include "Observers.h"
+#include "SendThreadPool.h"
 #include "TraceLevels.h"
 
 using namespace std;
@@ -96,6 +98,12 @@ Instance::Instance(
 
         _timer = make_shared<IceInternal::Timer>();
 
+        int sendThreads = properties->getIcePropertyAsInt("IceStorm.Send.Threads");
+        if (sendThreads > 0)
+        {
+            _sendThreadPool = make_shared<SendThreadPool>(sendThreads);
+        }
+
         string policy = properties->getIceProperty("IceStorm.Send.QueueSizeMaxPolicy");
         if (policy == "RemoveSubscriber")
         {
@@ -269,6 +277,12 @@ Instance::sendQueueSizeMaxPolicy() const
     return _sendQueueSizeMaxPolicy;
 }
 
+shared_ptr<SendThreadPool>
+Instance::sendThreadPool() const
+{
+    return _sendThreadPool;
+}
+
 void
 Instance::shutdown() noexcept
 {
@@ -286,6 +300,12 @@ Instance::shutdown() noexcept
     {
         _timer->destroy();
     }
+
+    // The adapters are destroyed, so no publish uses the send threads anymore.
+    if (_sendThreadPool)
+    {
+        _sendThreadPool->destroy();
+    }
 }
 
 void
@@ -322,7 +342,7 @@ PersistentInstance::PersistentInstance(
       _dbLock(getLMDBPath(communicator->getProperties(), serviceName) + "/icedb.lock"),
       _dbEnv(
           getLMDBPath(communicator->getProperties(), serviceName),
-          2,
+          4,
           IceDB::getMapSize(communicator->getProperties()->getIcePropertyAsInt("IceStorm.LMDB.MapSize")))
 {
     try
@@ -333,8 +353,29 @@ PersistentInstance::PersistentInstance(
 
         _lluMap = LLUMap(txn, "llu", dbContext, MDB_CREATE);
         _subscriberMap = SubscriberMap(txn, "subscribers", dbContext, MDB_CREATE, compareSubscriberRecordKey);
+        EventMap eventMap(txn, "events", dbContext, MDB_CREATE, compareEventRecordKey);
+        EventOffsetMap offsetMap(txn, "eventOffsets", dbContext, MDB_CREATE);
 
         txn.commit();
+
+        if (!properties()->getIceProperty("IceStorm.EventLog.Topics").empty())
+        {
+            if (this->nodeProxy())
+            {
+                // Each replica only receives the events published to this replica, its log can't be replayed.
+                Ice::Warning warn(traceLevels()->logger);
+                warn << "IceStorm.EventLog.Topics is ignored by replicated IceStorm services";
+            }
+            else
+            {
+                _eventLog = make_shared<EventLog>(
+                    _dbEnv,
+                    std::move(eventMap),
+                    std::move(offsetMap),
+                    properties(),
+                    traceLevels());
+            }
+        }
     }
     catch (const std::exception&)
     {
@@ -18,6 +18,8 @@ namespace IceStormElection
 
 namespace IceStorm
 {
+    class EventLog;
+    class SendThreadPool;
     class TraceLevels;
 
     class TopicReaper
@@ -76,6 +78,8 @@ namespace IceStorm
         [[nodiscard]] std::chrono::milliseconds sendTimeout() const;
         [[nodiscard]] int sendQueueSizeMax() const;
         [[nodiscard]] SendQueueSizeMaxPolicy sendQueueSizeMaxPolicy() const;
+        // The threads that queue published events to the subscribers, or nullptr if IceStorm.Send.Threads is 0.
+        [[nodiscard]] std::shared_ptr<SendThreadPool> sendThreadPool() const;
 
         void shutdown() noexcept;
         virtual void destroy() noexcept;
@@ -100,6 +104,7 @@ namespace IceStorm
         std::shared_ptr<IceStormElection::NodeI> _node;
         std::shared_ptr<IceStormElection::Observers> _observers;
         IceInternal::TimerPtr _timer;
+        std::shared_ptr<SendThreadPool> _sendThreadPool;
         std::shared_ptr<IceStorm::Instrumentation::TopicManagerObserver> _observer;
     };
 
@@ -122,6 +127,9 @@ namespace IceStorm
         [[nodiscard]] LLUMap lluMap() const { return _lluMap; }
         [[nodiscard]] SubscriberMap subscriberMap() const { return _subscriberMap; }
 
+        // The event log, or nullptr if no topic is configured with an event log.
+        [[nodiscard]] std::shared_ptr<EventLog> eventLog() const { return _eventLog; }
+
         void destroy() noexcept override;
 
     private:
@@ -129,6 +137,7 @@ namespace IceStorm
         IceDB::Env _dbEnv;
         LLUMap _lluMap;
         SubscriberMap _subscriberMap;
+        std::shared_ptr<EventLog> _eventLog;
     };
 
 } // End namespace IceStorm
@@ -12,10 +12,12 @@ $(project)_cppflags             := $(if $(lmdb_includedir),-I$(lmdb_includedir))
 IceStormService_targetdir       := $(libdir)
 IceStormService_dependencies    := IceGrid IceBox IceDB
 IceStormService_devinstall      := no
-IceStormService_sources         := $(addprefix $(currentdir)/,Instance.cpp \
+IceStormService_sources         := $(addprefix $(currentdir)/,EventLog.cpp \
+                                                             Instance.cpp \
                                                              InstrumentationI.cpp \
                                                              NodeI.cpp \
                                                              Observers.cpp \
+                                                             SendThreadPool.cpp \
                                                              Service.cpp \
                                                              Subscriber.cpp \
                                                              TopicI.cpp \
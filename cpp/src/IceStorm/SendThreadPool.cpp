@@ -0,0 +1,148 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "SendThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+
+using namespace std;
+using namespace IceStorm;
+
+namespace
+{
+    // Queuing events to a subscriber is cheap, so a range smaller than this isn't worth handing to another thread.
+    const size_t minRangeSize = 32;
+}
+
+SendThreadPool::SendThreadPool(int size)
+{
+    assert(size > 0);
+    _threads.reserve(static_cast<size_t>(size));
+    for (int i = 0; i < size; ++i)
+    {
+        _threads.emplace_back([this] { run(); });
+    }
+}
+
+SendThreadPool::~SendThreadPool() { destroy(); }
+
+void
+SendThreadPool::forEach(size_t count, const function<void(size_t)>& f)
+{
+    size_t ranges = min(_threads.size() + 1, (count + minRangeSize - 1) / minRangeSize);
+    unique_lock lock(_mutex);
+    if (ranges <= 1 || _destroyed)
+    {
+        lock.unlock();
+        for (size_t i = 0; i < count; ++i)
+        {
+            f(i);
+        }
+        return;
+    }
+
+    // The pool threads run the ranges after the first one. The state below is protected by _mutex, and the tasks
+    // reference it until pending drops to 0.
+    size_t rangeSize = (count + ranges - 1) / ranges;
+    size_t pending = 0;
+    exception_ptr exception;
+    condition_variable done;
+    for (size_t begin = rangeSize; begin < count; begin += rangeSize)
+    {
+        size_t end = min(count, begin + rangeSize);
+        ++pending;
+        _ranges.emplace_back(
+            [this, &f, &pending, &exception, &done, begin, end]
+            {
+                exception_ptr ex;
+                try
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        f(i);
+                    }
+                }
+                catch (...)
+                {
+                    ex = current_exception();
+                }
+
+                lock_guard rangeLock(_mutex);
+                if (ex && !exception)
+                {
+                    exception = ex;
+                }
+                if (--pending == 0)
+                {
+                    done.notify_one();
+                }
+            });
+    }
+    lock.unlock();
+    _conditionVariable.notify_all();
+
+    exception_ptr ex;
+    try
+    {
+        for (size_t i = 0; i < rangeSize; ++i)
+        {
+            f(i);
+        }
+    }
+    catch (...)
+    {
+        ex = current_exception();
+    }
+
+    lock.lock();
+    done.wait(lock, [&pending] { return pending == 0; });
+    if (!ex)
+    {
+        ex = exception;
+    }
+    lock.unlock();
+    if (ex)
+    {
+        rethrow_exception(ex);
+    }
+}
+
+void
+SendThreadPool::destroy() noexcept
+{
+    {
+        lock_guard lock(_mutex);
+        if (_destroyed)
+        {
+            return;
+        }
+        _destroyed = true;
+    }
+    _conditionVariable.notify_all();
+
+    for (auto& thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+void
+SendThreadPool::run()
+{
+    while (true)
+    {
+        function<void()> range;
+        {
+            unique_lock lock(_mutex);
+            _conditionVariable.wait(lock, [this] { return _destroyed || !_ranges.empty(); });
+            if (_ranges.empty())
+            {
+                return;
+            }
+            range = std::move(_ranges.front());
+            _ranges.pop_front();
+        }
+        range();
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICESTORM_SEND_THREAD_POOL_H
+#define ICESTORM_SEND_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace IceStorm
+{
+    //
+    // The threads configured with IceStorm.Send.Threads. A topic uses them to queue the events of a publish to its
+    // subscribers in parallel with the publishing thread.
+    //
+    class SendThreadPool
+    {
+    public:
+        explicit SendThreadPool(int);
+        ~SendThreadPool();
+
+        // Calls the given function with each index from 0 to the given count minus 1. The indexes are split in ranges
+        // of consecutive indexes, one of them run by the calling thread and the others by the pool threads. Returns
+        // once all the calls have returned, and rethrows the first exception raised by a call.
+        void forEach(std::size_t, const std::function<void(std::size_t)>&);
+
+        // Waits for the pending ranges to be run and joins the threads. forEach runs all the calls on the calling
+        // thread after destroy.
+        void destroy() noexcept;
+
+    private:
+        void run();
+
+        std::vector<std::thread> _threads;
+        std::deque<std::function<void()>> _ranges;
+        bool _destroyed{false};
+        std::mutex _mutex;
+        std::condition_variable _conditionVariable;
+    };
+}
+
+#endif
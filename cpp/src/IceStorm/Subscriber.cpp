@@ -5,9 +5,11 @@
 #include "Ice/StringUtil.h"
 #include "Instance.h"
 #include "NodeI.h"
+#include "SendThreadPool.h"
 #include "TraceLevels.h"
 #include "Util.h"
 
+#include <algorithm>
 #include <iterator>
 #include <stdexcept>
 
@@ -15,6 +17,30 @@ using namespace std;
 using namespace IceStorm;
 using namespace IceStormElection;
 
+namespace
+{
+    // The maximum number of logged events queued at once to replay them to a subscriber.
+    const size_t replayChunkSize = 100;
+
+    // Returns the offset of a logged event, or nullopt if the event isn't logged.
+    optional<int64_t> eventOffset(const EventData& event)
+    {
+        auto p = event.context.find(eventOffsetContextKey);
+        if (p == event.context.end())
+        {
+            return nullopt;
+        }
+        try
+        {
+            return stoll(p->second);
+        }
+        catch (const std::exception&)
+        {
+            return nullopt;
+        }
+    }
+}
+
 //
 // Per Subscriber object.
 //
@@ -37,9 +63,7 @@ namespace
             Ice::ByteSeq data(inParams.first, inParams.second);
             event.data.swap(data);
 
-            EventDataSeq e;
-            e.push_back(std::move(event));
-            _subscriber->queue(false, std::move(e));
+            _subscriber->queue(false, {make_shared<const EventData>(std::move(event))});
             return true;
         }
 
@@ -95,12 +119,14 @@ namespace
             const Ice::ObjectPrx&,
             int,
             int,
+            bool,
             Ice::ObjectPrx);
 
         void flush() override;
 
     private:
         const Ice::ObjectPrx _obj;
+        const bool _ordered;
     };
 
     class SubscriberLink final : public Subscriber
@@ -134,19 +160,19 @@ SubscriberOneway::flush()
     //
     // If the subscriber isn't online we're done.
     //
-    if (_state != SubscriberStateOnline || _events.empty())
+    if (_state != SubscriberStateOnline || !pendingEvents())
     {
         return;
     }
 
     // Send up to _maxOutstanding pending events.
-    while (_outstanding < _maxOutstanding && !_events.empty())
+    while (_outstanding < _maxOutstanding && pendingEvents())
     {
         //
         // Dequeue the head event, count one more outstanding AMI
         // request.
         //
-        EventData e = std::move(_events.front());
+        EventDataPtr e = std::move(_events.front());
         _events.pop_front();
         if (_observer)
         {
@@ -160,9 +186,9 @@ SubscriberOneway::flush()
             auto future = isSent->get_future();
 
             _obj->ice_invokeAsync(
-                e.op,
-                e.mode,
-                e.data,
+                e->op,
+                e->mode,
+                e->data,
                 nullptr,
                 [self](exception_ptr ex) { self->error(true, ex); },
                 [self, isSent](bool sentSynchronously)
@@ -173,7 +199,7 @@ SubscriberOneway::flush()
                         self->sentAsynchronously();
                     }
                 },
-                e.context);
+                e->context);
 
             //
             // Check if the request is (or potentially was) sent asynchronously
@@ -223,7 +249,7 @@ SubscriberOneway::sentAsynchronously()
     {
         _condVar.notify_one();
     }
-    else if (_outstanding <= 0 && !_events.empty())
+    else if (_outstanding <= 0 && pendingEvents())
     {
         flush();
     }
@@ -235,9 +261,11 @@ SubscriberTwoway::SubscriberTwoway(
     const Ice::ObjectPrx& proxy,
     int retryCount,
     int maxOutstanding,
+    bool ordered,
     Ice::ObjectPrx obj)
     : Subscriber(instance, rec, proxy, retryCount, maxOutstanding),
-      _obj(std::move(obj))
+      _obj(std::move(obj)),
+      _ordered(ordered)
 {
 }
 
@@ -249,21 +277,40 @@ SubscriberTwoway::flush()
     //
     // If the subscriber isn't online we're done.
     //
-    if (_state != SubscriberStateOnline || _events.empty())
+    if (_state != SubscriberStateOnline || !pendingEvents())
     {
         return;
     }
 
-    // Send up to _maxOutstanding pending events.
-    while (_outstanding < _maxOutstanding && !_events.empty())
+    //
+    // The requests of an ordered subscriber with a window greater than 1 are pipelined over the subscriber
+    // connection: a fixed proxy sends them in order over this connection and never retries them over another
+    // connection. Until the connection is established, a single request is outstanding.
+    //
+    Ice::ObjectPrx obj = _obj;
+    int maxOutstanding = _maxOutstanding;
+    if (_ordered && _maxOutstanding > 1)
+    {
+        auto connection = _obj->ice_getCachedConnection();
+        if (connection)
+        {
+            obj = _obj->ice_fixed(connection);
+        }
+        else
+        {
+            maxOutstanding = 1;
+        }
+    }
+
+    // Send up to maxOutstanding requests, each request is acknowledged by its response.
+    while (_outstanding < maxOutstanding && pendingEvents())
     {
         //
         // Dequeue the head event, count one more outstanding AMI
         // request.
         //
-        EventData e = std::move(_events.front());
+        EventDataPtr e = std::move(_events.front());
         _events.pop_front();
-
         ++_outstanding;
 
         if (_observer)
@@ -273,15 +320,15 @@ SubscriberTwoway::flush()
 
         try
         {
-            auto self = static_pointer_cast<SubscriberTwoway>(shared_from_this());
-            _obj->ice_invokeAsync(
-                e.op,
-                e.mode,
-                e.data,
-                [self](bool, const vector<byte>&) { self->completed(); },
+            auto self = shared_from_this();
+            obj->ice_invokeAsync(
+                e->op,
+                e->mode,
+                e->data,
+                [self](bool, const vector<byte>&) { self->completed(1); },
                 [self](exception_ptr ex) { self->error(true, ex); },
                 nullptr,
-                e.context);
+                e->context);
         }
         catch (const std::exception&)
         {
@@ -309,17 +356,15 @@ namespace
             return;
         }
 
-        EventDataSeq v;
-        v.swap(_events);
-
-        auto p = v.begin();
-        while (p != v.end())
+        // The events are shared with the other subscribers of the topic, forward them without copying.
+        vector<EventDataPtr> v;
+        for (const auto& event : _events)
         {
             if (_rec.cost != 0)
             {
                 int cost = 0;
-                auto q = p->context.find("cost");
-                if (q != p->context.end())
+                auto q = event->context.find("cost");
+                if (q != event->context.end())
                 {
                     try
                     {
@@ -332,28 +377,40 @@ namespace
                 }
                 if (cost > _rec.cost)
                 {
-                    p = v.erase(p);
                     continue;
                 }
             }
-            ++p;
+            v.push_back(event);
         }
+        _events.clear();
 
         if (!v.empty())
         {
             try
             {
                 ++_outstanding;
+                auto count = static_cast<int>(v.size());
                 if (_observer)
                 {
-                    _outstandingCount = static_cast<int>(v.size());
-                    _observer->outstanding(_outstandingCount);
+                    _observer->outstanding(count);
+                }
+
+                // Marshal the in-parameters of TopicLink::forward, an EventDataSeq, directly from the shared events.
+                Ice::OutputStream out{_obj->ice_getCommunicator(), _obj->ice_getEncodingVersion()};
+                out.startEncapsulation(_obj->ice_getEncodingVersion(), nullopt);
+                out.writeSize(count);
+                for (const auto& event : v)
+                {
+                    out.write(*event);
                 }
+                out.endEncapsulation();
 
                 auto self = shared_from_this();
-                _obj->forwardAsync(
-                    v,
-                    [self]() { self->completed(); },
+                _obj->ice_invokeAsync(
+                    "forward",
+                    Ice::OperationMode::Normal,
+                    out.finished(),
+                    [self, count](bool, pair<const byte*, const byte*>) { self->completed(count); },
                     [self](exception_ptr ex) { self->error(true, ex); });
             }
             catch (const std::exception&)
@@ -408,6 +465,18 @@ Subscriber::create(const shared_ptr<Instance>& instance, const SubscriberRecord&
                 throw BadQoS("invalid reliability: " + reliability);
             }
 
+            // The maximum number of outstanding requests of a twoway subscriber, 0 for the default.
+            int window = 0;
+            p = rec.theQoS.find("window");
+            if (p != rec.theQoS.end())
+            {
+                istringstream is(IceInternal::trim(p->second));
+                if (!(is >> window) || !is.eof() || window < 1)
+                {
+                    throw BadQoS("invalid window (positive numeric value required): " + p->second);
+                }
+            }
+
             // Override the invocation timeout.
             optional<Ice::ObjectPrx> newObj;
             try
@@ -463,7 +532,14 @@ Subscriber::create(const shared_ptr<Instance>& instance, const SubscriberRecord&
                 {
                     throw BadQoS("ordered reliability requires a twoway proxy");
                 }
-                subscriber = make_shared<SubscriberTwoway>(instance, rec, proxy, retryCount, 1, *newObj);
+                subscriber = make_shared<SubscriberTwoway>(
+                    instance,
+                    rec,
+                    proxy,
+                    retryCount,
+                    window > 0 ? window : 1,
+                    true,
+                    *newObj);
             }
             else if (newObj->ice_isOneway() || newObj->ice_isDatagram())
             {
@@ -472,7 +548,14 @@ Subscriber::create(const shared_ptr<Instance>& instance, const SubscriberRecord&
             else // if(newObj->ice_isTwoway())
             {
                 assert(newObj->ice_isTwoway());
-                subscriber = make_shared<SubscriberTwoway>(instance, rec, proxy, retryCount, 5, *newObj);
+                subscriber = make_shared<SubscriberTwoway>(
+                    instance,
+                    rec,
+                    proxy,
+                    retryCount,
+                    window > 0 ? window : 5,
+                    false,
+                    *newObj);
             }
             per->setSubscriber(subscriber);
         }
@@ -504,8 +587,16 @@ Subscriber::record() const
     return _rec;
 }
 
+void
+Subscriber::replay(shared_ptr<EventLog> eventLog, EventLog::ReplayPosition position)
+{
+    lock_guard lock(_mutex);
+    _eventLog = std::move(eventLog);
+    _replayPosition = position;
+}
+
 bool
-Subscriber::queue(bool forwarded, EventDataSeq events)
+Subscriber::queue(bool forwarded, const vector<EventDataPtr>& events)
 {
     lock_guard lock(_mutex);
 
@@ -535,8 +626,22 @@ Subscriber::queue(bool forwarded, EventDataSeq events)
 
         case SubscriberStateOnline:
         {
-            for (auto& event : events)
+            int32_t queued = 0;
+            for (const auto& event : events)
             {
+                //
+                // The logged events are queued by the replay until it reaches the end of the event log: they're
+                // skipped while replaying, and the events replayed before the end of the replay are skipped after.
+                //
+                if (_eventLog || _replayEnd)
+                {
+                    auto offset = eventOffset(*event);
+                    if (offset && (_eventLog || *offset < *_replayEnd))
+                    {
+                        continue;
+                    }
+                }
+
                 if (static_cast<int>(_events.size()) == _instance->sendQueueSizeMax())
                 {
                     if (_instance->sendQueueSizeMaxPolicy() == Instance::RemoveSubscriber)
@@ -549,12 +654,13 @@ Subscriber::queue(bool forwarded, EventDataSeq events)
                         _events.pop_front();
                     }
                 }
-                _events.push_back(std::move(event));
+                _events.push_back(event);
+                ++queued;
             }
 
             if (_observer)
             {
-                _observer->queued(static_cast<int32_t>(events.size()));
+                _observer->queued(queued);
             }
             flush();
             break;
@@ -628,7 +734,7 @@ Subscriber::destroy()
 }
 
 void
-Subscriber::completed()
+Subscriber::completed(int delivered)
 {
     lock_guard lock(_mutex);
 
@@ -637,7 +743,7 @@ Subscriber::completed()
     assert(_outstanding >= 0 && _outstanding < _maxOutstanding);
     if (_observer)
     {
-        _observer->delivered(_outstandingCount);
+        _observer->delivered(delivered);
     }
 
     //
@@ -875,6 +981,67 @@ namespace
     }
 }
 
+bool
+Subscriber::pendingEvents()
+{
+    if (!_eventLog || _state != SubscriberStateOnline)
+    {
+        return !_events.empty();
+    }
+
+    // Read the next logged events once the queue is half empty, without exceeding the maximum size of the queue.
+    size_t maxEvents = replayChunkSize;
+    if (_instance->sendQueueSizeMax() > 0)
+    {
+        maxEvents = min(maxEvents, static_cast<size_t>(_instance->sendQueueSizeMax()));
+    }
+    if (_events.size() > maxEvents / 2)
+    {
+        return true;
+    }
+
+    const size_t count = maxEvents - _events.size();
+    EventDataSeq events;
+    try
+    {
+        events = _eventLog->replay(_rec.topicName, _replayPosition, count);
+    }
+    catch (const std::exception&)
+    {
+        error(false, current_exception());
+        return false;
+    }
+    _replayed += static_cast<int64_t>(events.size());
+
+    if (events.size() < count)
+    {
+        // The replay reached the end of the event log, the events logged from now on are queued by the publishers.
+        _eventLog = nullptr;
+        _replayEnd = _replayPosition.offset;
+
+        auto traceLevels = _instance->traceLevels();
+        if (traceLevels->topic > 0)
+        {
+            Ice::Trace out(traceLevels->logger, traceLevels->topicCat);
+            out << _rec.topicName << ": replayed " << _replayed << " events to "
+                << _instance->communicator()->identityToString(_rec.id);
+        }
+    }
+
+    if (!events.empty())
+    {
+        if (_observer)
+        {
+            _observer->queued(static_cast<int32_t>(events.size()));
+        }
+        for (auto& event : shareEvents(std::move(events)))
+        {
+            _events.push_back(std::move(event));
+        }
+    }
+    return !_events.empty();
+}
+
 void
 Subscriber::setState(Subscriber::SubscriberState state)
 {
@@ -904,6 +1071,60 @@ Subscriber::setState(Subscriber::SubscriberState state)
     }
 }
 
+vector<EventDataPtr>
+IceStorm::shareEvents(EventDataSeq events)
+{
+    vector<EventDataPtr> shared;
+    shared.reserve(events.size());
+    for (auto& event : events)
+    {
+        shared.push_back(make_shared<const EventData>(std::move(event)));
+    }
+    return shared;
+}
+
+Ice::IdentitySeq
+IceStorm::queueEvents(
+    const Instance& instance,
+    const vector<shared_ptr<Subscriber>>& subscribers,
+    bool forwarded,
+    const vector<EventDataPtr>& events)
+{
+    Ice::IdentitySeq reap;
+    auto sendThreadPool = instance.sendThreadPool();
+    if (!sendThreadPool)
+    {
+        for (const auto& subscriber : subscribers)
+        {
+            if (!subscriber->queue(forwarded, events) && subscriber->reap())
+            {
+                reap.push_back(subscriber->id());
+            }
+        }
+        return reap;
+    }
+
+    // Each call sets its own element, so the calls from the send threads don't need to be synchronized.
+    vector<char> reaped(subscribers.size(), 0);
+    sendThreadPool->forEach(
+        subscribers.size(),
+        [&](size_t i)
+        {
+            if (!subscribers[i]->queue(forwarded, events) && subscribers[i]->reap())
+            {
+                reaped[i] = 1;
+            }
+        });
+    for (size_t i = 0; i < subscribers.size(); ++i)
+    {
+        if (reaped[i])
+        {
+            reap.push_back(subscribers[i]->id());
+        }
+    }
+    return reap;
+}
+
 bool
 IceStorm::operator==(const shared_ptr<Subscriber>& subscriber, const Ice::Identity& id)
 {
@@ -3,12 +3,14 @@
 #ifndef ICESTORM_SUBSCRIBER_H
 #define ICESTORM_SUBSCRIBER_H
 
+#include "EventLog.h"
 #include "Ice/ObserverHelper.h"
 #include "IceStormInternal.h"
 #include "Instrumentation.h"
 #include "SubscriberRecord.h"
 
 #include <condition_variable>
+#include <deque>
 
 #if defined(__clang__)
 #    pragma clang diagnostic push
@@ -19,6 +21,12 @@ namespace IceStorm
 {
     class Instance;
 
+    // An event queued to subscribers. The event is shared by all the subscribers it's queued to.
+    using EventDataPtr = std::shared_ptr<const EventData>;
+
+    // Converts events into shared events, to queue them to subscribers.
+    std::vector<EventDataPtr> shareEvents(EventDataSeq);
+
     class SendQueueSizeMaxReachedException final : public Ice::LocalException
     {
     public:
@@ -39,8 +47,13 @@ namespace IceStorm
         [[nodiscard]] Ice::Identity id() const;                    // Return the id of the subscriber.
         [[nodiscard]] IceStorm::SubscriberRecord record() const;   // Get the subscriber record.
 
+        // Replays the events logged from the given position before the events queued by the publishers. The logged
+        // events are read as the queue of the subscriber drains. Must be called before adding the subscriber to the
+        // topic.
+        void replay(std::shared_ptr<EventLog>, EventLog::ReplayPosition);
+
         // Returns false if the subscriber should be reaped.
-        bool queue(bool, EventDataSeq);
+        bool queue(bool, const std::vector<EventDataPtr>&);
         bool reap();
         void resetIfReaped();
         [[nodiscard]] bool errored() const;
@@ -48,7 +61,7 @@ namespace IceStorm
         void destroy();
 
         // To be called by the AMI callbacks only.
-        void completed();
+        void completed(int); // The number of events delivered by the completed request.
         void error(bool, std::exception_ptr);
 
         void shutdown();
@@ -68,6 +81,10 @@ namespace IceStorm
     protected:
         void setState(SubscriberState);
 
+        // Returns true if the queue isn't empty, after queueing the next logged events to replay if it runs low. Must
+        // be called with the mutex locked.
+        bool pendingEvents();
+
         Subscriber(std::shared_ptr<Instance>, IceStorm::SubscriberRecord, std::optional<Ice::ObjectPrx>, int, int);
 
         // Immutable
@@ -85,10 +102,13 @@ namespace IceStorm
 
         SubscriberState _state{SubscriberStateOnline}; // The subscriber state.
 
-        int _outstanding{0}; // The current number of outstanding responses.
-        int _outstandingCount{
-            1};               // The current number of outstanding events when batching events (only used for metrics).
-        EventDataSeq _events; // The queue of events to send.
+        int _outstanding{0};              // The current number of outstanding responses.
+        std::deque<EventDataPtr> _events; // The queue of events to send.
+
+        std::shared_ptr<EventLog> _eventLog;      // The event log being replayed, null once the replay ends.
+        EventLog::ReplayPosition _replayPosition; // The position of the next logged event to replay.
+        std::int64_t _replayed{0};                // The number of replayed events.
+        std::optional<std::int64_t> _replayEnd;   // The offset of the first event not replayed, once the replay ends.
 
         // The next time to try sending a new event if we're offline.
         std::chrono::steady_clock::time_point _next;
@@ -97,6 +117,14 @@ namespace IceStorm
         IceInternal::ObserverHelperT<IceStorm::Instrumentation::SubscriberObserver> _observer;
     };
 
+    // Queues the events to each of the subscribers, with the send threads of the instance if it has some. Returns
+    // the ids of the subscribers to reap.
+    Ice::IdentitySeq queueEvents(
+        const Instance&,
+        const std::vector<std::shared_ptr<Subscriber>>&,
+        bool,
+        const std::vector<EventDataPtr>&);
+
     bool operator==(const std::shared_ptr<IceStorm::Subscriber>&, const Ice::Identity&);
     bool operator==(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
     bool operator!=(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
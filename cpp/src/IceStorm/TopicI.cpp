@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "TopicI.h"
+#include "EventLog.h"
 #include "Ice/LoggerUtil.h"
 #include "Instance.h"
 #include "NodeI.h"
@@ -47,7 +48,7 @@ namespace
 
             EventDataSeq v;
             v.push_back(std::move(event));
-            _topic->publish(false, v);
+            _topic->publish(false, std::move(v));
 
             return true;
         }
@@ -73,7 +74,7 @@ namespace
         void forward(EventDataSeq v, const Ice::Current&) override
         {
             // The publish call does a cached read.
-            _impl->publish(true, v);
+            _impl->publish(true, std::move(v));
         }
 
     private:
@@ -384,6 +385,8 @@ TopicImpl::TopicImpl(
     : _instance(std::move(instance)),
       _name(std::move(name)),
       _id(std::move(id)),
+      _eventLog(_instance->eventLog() && _instance->eventLog()->isLogged(_name) ? _instance->eventLog() : nullptr),
+      _subscribers(make_shared<const vector<shared_ptr<Subscriber>>>()),
       _lluMap(_instance->lluMap()),
       _subscriberMap(_instance->subscriberMap())
 {
@@ -392,6 +395,7 @@ TopicImpl::TopicImpl(
         //
         // Re-establish subscribers.
         //
+        vector<shared_ptr<Subscriber>> recreated;
         for (const auto& subscriber : subscribers)
         {
             Ice::Identity ident = subscriber.obj->ice_getIdentity();
@@ -412,7 +416,7 @@ TopicImpl::TopicImpl(
                 // Create the subscriber object add it to the set of
                 // subscribers.
                 //
-                _subscribers.push_back(Subscriber::create(_instance, subscriber));
+                recreated.push_back(Subscriber::create(_instance, subscriber));
             }
             catch (const Ice::Exception& ex)
             {
@@ -425,6 +429,7 @@ TopicImpl::TopicImpl(
                 out << " failed: " << ex;
             }
         }
+        _subscribers = make_shared<const vector<shared_ptr<Subscriber>>>(std::move(recreated));
 
         if (_instance->observer())
         {
@@ -495,67 +500,90 @@ TopicImpl::subscribeAndGetPublisher(QoS qos, Ice::ObjectPrx obj)
 {
     auto id = obj->ice_getIdentity();
     auto traceLevels = _instance->traceLevels();
-    lock_guard lock(_subscribersMutex);
-    if (traceLevels->topic > 0)
+
+    optional<EventLog::ReplayPosition> replay = EventLog::getReplayPosition(qos);
+    if (replay && !_eventLog)
     {
-        Ice::Trace out(traceLevels->logger, traceLevels->topicCat);
-        out << _name << ": subscribeAndGetPublisher: " << _instance->communicator()->identityToString(id);
+        throw BadQoS("topic `" + _name + "' doesn't have an event log to replay");
+    }
 
-        if (traceLevels->topic > 1)
+    shared_ptr<Subscriber> subscriber;
+    {
+        lock_guard lock(_subscribersMutex);
+        if (traceLevels->topic > 0)
         {
-            out << " endpoints: " << IceStormInternal::describeEndpoints(obj) << " QoS: ";
-            for (auto p = qos.begin(); p != qos.end(); ++p)
+            Ice::Trace out(traceLevels->logger, traceLevels->topicCat);
+            out << _name << ": subscribeAndGetPublisher: " << _instance->communicator()->identityToString(id);
+
+            if (traceLevels->topic > 1)
             {
-                if (p != qos.begin())
+                out << " endpoints: " << IceStormInternal::describeEndpoints(obj) << " QoS: ";
+                for (auto p = qos.begin(); p != qos.end(); ++p)
                 {
-                    out << ',';
+                    if (p != qos.begin())
+                    {
+                        out << ',';
+                    }
                 }
+                out << " subscriptions: ";
+                trace(out, _instance, *_subscribers);
             }
-            out << " subscriptions: ";
-            trace(out, _instance, _subscribers);
         }
-    }
 
-    SubscriberRecord record;
-    record.id = id;
-    record.obj = obj;
-    record.theQoS = qos;
-    record.topicName = _name;
-    record.link = false;
-    record.cost = 0;
+        SubscriberRecord record;
+        record.id = id;
+        record.obj = obj;
+        record.theQoS = qos;
+        record.topicName = _name;
+        record.link = false;
+        record.cost = 0;
 
-    if (find(_subscribers.begin(), _subscribers.end(), record.id) != _subscribers.end())
-    {
-        throw AlreadySubscribed();
-    }
+        if (find(_subscribers->begin(), _subscribers->end(), record.id) != _subscribers->end())
+        {
+            throw AlreadySubscribed();
+        }
 
-    LogUpdate llu;
+        LogUpdate llu;
 
-    auto subscriber = Subscriber::create(_instance, record);
-    try
-    {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
+        subscriber = Subscriber::create(_instance, record);
+        try
+        {
+            IceDB::ReadWriteTxn txn(_instance->dbEnv());
 
-        SubscriberRecordKey key;
-        key.topic = _id;
-        key.id = subscriber->id();
+            SubscriberRecordKey key;
+            key.topic = _id;
+            key.id = subscriber->id();
 
-        _subscriberMap.put(txn, key, record);
+            _subscriberMap.put(txn, key, record);
 
-        llu = getIncrementedLLU(txn, _lluMap);
+            llu = getIncrementedLLU(txn, _lluMap);
 
-        txn.commit();
+            txn.commit();
+        }
+        catch (const IceDB::LMDBException& ex)
+        {
+            logError(_instance->communicator(), ex);
+            subscriber->destroy();
+            throw; // will become UnknownException in caller
+        }
+
+        // The subscriber replays the logged events before the events published from now on, which are logged too.
+        if (replay)
+        {
+            subscriber->replay(_eventLog, *replay);
+        }
+
+        updateSubscribers([&subscriber](auto& subscribers) { subscribers.push_back(subscriber); });
+
+        _instance->observers()->addSubscriber(llu, _name, record);
     }
-    catch (const IceDB::LMDBException& ex)
+
+    // Queue the first logged events with the mutex unlocked, the next ones are queued as the subscriber sends them.
+    if (replay)
     {
-        logError(_instance->communicator(), ex);
-        throw; // will become UnknownException in caller
+        subscriber->flush();
     }
 
-    _subscribers.push_back(subscriber);
-
-    _instance->observers()->addSubscriber(llu, _name, record);
-
     auto publisher = subscriber->proxy();
     assert(publisher); // The publisher is always non-null when the subscriber record link is false.
     return *publisher;
@@ -576,7 +604,7 @@ TopicImpl::unsubscribe(const Ice::ObjectPrx& subscriber)
         if (traceLevels->topic > 1)
         {
             out << " endpoints: " << IceStormInternal::describeEndpoints(subscriber);
-            trace(out, _instance, _subscribers);
+            trace(out, _instance, *_subscribers);
         }
     }
     removeSubscribers(Ice::IdentitySeq{id});
@@ -622,7 +650,7 @@ TopicImpl::link(const TopicPrx& topic, int cost)
     record.link = true;
     record.cost = cost;
 
-    if (find(_subscribers.begin(), _subscribers.end(), record.id) != _subscribers.end())
+    if (find(_subscribers->begin(), _subscribers->end(), record.id) != _subscribers->end())
     {
         string name = IceStormInternal::identityToTopicName(id);
         throw LinkExists(name);
@@ -652,7 +680,7 @@ TopicImpl::link(const TopicPrx& topic, int cost)
         throw; // will become UnknownException in caller
     }
 
-    _subscribers.push_back(subscriber);
+    updateSubscribers([&subscriber](auto& subscribers) { subscribers.push_back(subscriber); });
 
     _instance->observers()->addSubscriber(llu, _name, record);
 }
@@ -671,7 +699,7 @@ TopicImpl::unlink(const TopicPrx& topic)
 
     auto traceLevels = _instance->traceLevels();
 
-    if (find(_subscribers.begin(), _subscribers.end(), id) == _subscribers.end())
+    if (find(_subscribers->begin(), _subscribers->end(), id) == _subscribers->end())
     {
         string name = IceStormInternal::identityToTopicName(id);
 
@@ -726,7 +754,7 @@ TopicImpl::shutdown()
     _servant = nullptr;
 
     // Shutdown each subscriber. This waits for the event queues to drain.
-    for (const auto& subscriber : _subscribers)
+    for (const auto& subscriber : *_subscribers)
     {
         subscriber->shutdown();
     }
@@ -740,7 +768,7 @@ TopicImpl::getLinkInfoSeq() const
     lock_guard lock(_subscribersMutex);
 
     LinkInfoSeq seq;
-    for (const auto& subscriber : _subscribers)
+    for (const auto& subscriber : *_subscribers)
     {
         SubscriberRecord record = subscriber->record();
         if (record.link && !subscriber->errored())
@@ -761,7 +789,7 @@ TopicImpl::getSubscribers() const
     lock_guard lock(_subscribersMutex);
 
     Ice::IdentitySeq subscribers;
-    for (const auto& subscriber : _subscribers)
+    for (const auto& subscriber : *_subscribers)
     {
         subscribers.push_back(subscriber->id());
     }
@@ -800,7 +828,7 @@ TopicImpl::getContent() const
 
     TopicContent content;
     content.id = _id;
-    for (const auto& subscriber : _subscribers)
+    for (const auto& subscriber : *_subscribers)
     {
         // Don't return errored subscribers (subscribers that have
         // errored out, but not reaped due to a failure with the
@@ -823,50 +851,51 @@ TopicImpl::update(const SubscriberRecordSeq& records)
     // runs through the init list and add the ones that don't
     // exist.
 
-    {
-        auto p = _subscribers.begin();
-        while (p != _subscribers.end())
+    updateSubscribers(
+        [this, &records](auto& subscribers)
         {
-            SubscriberRecordSeq::const_iterator q;
-            for (q = records.begin(); q != records.end(); ++q)
+            auto p = subscribers.begin();
+            while (p != subscribers.end())
             {
-                if ((*p)->id() == q->id)
+                SubscriberRecordSeq::const_iterator q;
+                for (q = records.begin(); q != records.end(); ++q)
                 {
-                    break;
+                    if ((*p)->id() == q->id)
+                    {
+                        break;
+                    }
+                }
+                // The subscriber doesn't exist in the incoming subscriber
+                // set so destroy it.
+                if (q == records.end())
+                {
+                    (*p)->destroy();
+                    p = subscribers.erase(p);
+                }
+                else
+                {
+                    // Otherwise reset the reaped status if necessary.
+                    (*p)->resetIfReaped();
+                    ++p;
                 }
             }
-            // The subscriber doesn't exist in the incoming subscriber
-            // set so destroy it.
-            if (q == records.end())
-            {
-                (*p)->destroy();
-                p = _subscribers.erase(p);
-            }
-            else
-            {
-                // Otherwise reset the reaped status if necessary.
-                (*p)->resetIfReaped();
-                ++p;
-            }
-        }
-    }
 
-    for (const auto& record : records)
-    {
-        vector<shared_ptr<Subscriber>>::iterator q;
-        for (q = _subscribers.begin(); q != _subscribers.end(); ++q)
-        {
-            if ((*q)->id() == record.id)
+            for (const auto& record : records)
             {
-                break;
+                vector<shared_ptr<Subscriber>>::iterator q;
+                for (q = subscribers.begin(); q != subscribers.end(); ++q)
+                {
+                    if ((*q)->id() == record.id)
+                    {
+                        break;
+                    }
+                }
+                if (q == subscribers.end())
+                {
+                    subscribers.push_back(Subscriber::create(_instance, record));
+                }
             }
-        }
-        if (q == _subscribers.end())
-        {
-            auto subscriber = Subscriber::create(_instance, record);
-            _subscribers.push_back(subscriber);
-        }
-    }
+        });
 }
 
 bool
@@ -900,7 +929,7 @@ TopicImpl::proxy() const
 }
 
 void
-TopicImpl::publish(bool forwarded, const EventDataSeq& events)
+TopicImpl::publish(bool forwarded, EventDataSeq events)
 {
     optional<TopicInternalPrx> masterInternal;
     int64_t generation = -1;
@@ -910,10 +939,10 @@ TopicImpl::publish(bool forwarded, const EventDataSeq& events)
         CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
 
         //
-        // Copy of the subscriber list so that event publishing can occur
+        // Snapshot of the subscriber list so that event publishing can occur
         // in parallel.
         //
-        vector<shared_ptr<Subscriber>> copy;
+        shared_ptr<const vector<shared_ptr<Subscriber>>> subscribers;
         {
             lock_guard lock(_subscribersMutex);
 
@@ -928,20 +957,27 @@ TopicImpl::publish(bool forwarded, const EventDataSeq& events)
                     _observer->published();
                 }
             }
-            copy = _subscribers;
+            subscribers = _subscribers;
+
+            // The offsets are assigned with the mutex locked to log the events in the order they're queued.
+            if (_eventLog)
+            {
+                _eventLog->append(_name, events);
+            }
+        }
+
+        // Write the events to the event log before delivering them, so that they can always be replayed from the
+        // offset of a delivered event. The events published concurrently are written together.
+        if (_eventLog)
+        {
+            _eventLog->sync();
         }
 
         //
         // Queue each event, gathering a list of those subscribers that
-        // must be reaped.
+        // must be reaped. The events are shared by all the subscribers.
         //
-        for (const auto& subscriber : copy)
-        {
-            if (!subscriber->queue(forwarded, events) && subscriber->reap())
-            {
-                reap.push_back(subscriber->id());
-            }
-        }
+        reap = queueEvents(*_instance, *subscribers, forwarded, shareEvents(std::move(events)));
 
         // If there are no subscribers in error then we're done.
         if (reap.empty())
@@ -1013,7 +1049,7 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
         out << " llu: " << llu.generation << "/" << llu.iteration;
     }
 
-    if (find(_subscribers.begin(), _subscribers.end(), record.id) != _subscribers.end())
+    if (find(_subscribers->begin(), _subscribers->end(), record.id) != _subscribers->end())
     {
         // If the subscriber is already in the database display a
         // diagnostic.
@@ -1047,7 +1083,7 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
         throw; // will become UnknownException in caller
     }
 
-    _subscribers.push_back(subscriber);
+    updateSubscribers([&subscriber](auto& subscribers) { subscribers.push_back(subscriber); });
 }
 
 void
@@ -1095,15 +1131,19 @@ TopicImpl::observerRemoveSubscriber(const LogUpdate& llu, const Ice::IdentitySeq
     // Then remove the subscriber from the subscribers list. If the
     // subscriber had a local failure and was removed from the
     // subscriber list it could already be gone. That's not a problem.
-    for (const auto& id : ids)
-    {
-        auto p = find(_subscribers.begin(), _subscribers.end(), id);
-        if (p != _subscribers.end())
+    updateSubscribers(
+        [&ids](auto& subscribers)
         {
-            (*p)->destroy();
-            _subscribers.erase(p);
-        }
-    }
+            for (const auto& id : ids)
+            {
+                auto p = find(subscribers.begin(), subscribers.end(), id);
+                if (p != subscribers.end())
+                {
+                    (*p)->destroy();
+                    subscribers.erase(p);
+                }
+            }
+        });
 }
 
 void
@@ -1149,7 +1189,7 @@ TopicImpl::updateSubscriberObservers()
 {
     lock_guard lock(_subscribersMutex);
 
-    for (const auto& subscriber : _subscribers)
+    for (const auto& subscriber : *_subscribers)
     {
         subscriber->updateObserver();
     }
@@ -1200,6 +1240,18 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
         throw; // will become UnknownException in caller
     }
 
+    if (_eventLog)
+    {
+        try
+        {
+            _eventLog->destroy(_name);
+        }
+        catch (const IceDB::LMDBException& ex)
+        {
+            logError(_instance->communicator(), ex);
+        }
+    }
+
     assert(_linkPrx);
     _instance->publishAdapter()->remove(_linkPrx->ice_getIdentity());
 
@@ -1209,11 +1261,15 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
     _instance->topicReaper()->add(_name);
 
     // Destroy each of the subscribers.
-    for (const auto& subscriber : _subscribers)
-    {
-        subscriber->destroy();
-    }
-    _subscribers.clear();
+    updateSubscribers(
+        [](auto& subscribers)
+        {
+            for (const auto& subscriber : subscribers)
+            {
+                subscriber->destroy();
+            }
+            subscribers.clear();
+        });
 
     _instance->topicAdapter()->remove(_id);
 
@@ -1267,16 +1323,28 @@ TopicImpl::removeSubscribers(const Ice::IdentitySeq& ids)
         // replicas on the same subscriber). To avoid sending unnecessary
         // observer updates keep track of the observers that are actually
         // removed.
-        for (const auto& id : ids)
-        {
-            auto p = find(_subscribers.begin(), _subscribers.end(), id);
-            if (p != _subscribers.end())
+        updateSubscribers(
+            [&ids](auto& subscribers)
             {
-                (*p)->destroy();
-                _subscribers.erase(p);
-            }
-        }
+                for (const auto& id : ids)
+                {
+                    auto p = find(subscribers.begin(), subscribers.end(), id);
+                    if (p != subscribers.end())
+                    {
+                        (*p)->destroy();
+                        subscribers.erase(p);
+                    }
+                }
+            });
 
         _instance->observers()->removeSubscriber(llu, _name, ids);
     }
 }
+
+void
+TopicImpl::updateSubscribers(const function<void(vector<shared_ptr<Subscriber>>&)>& update)
+{
+    auto subscribers = make_shared<vector<shared_ptr<Subscriber>>>(*_subscribers);
+    update(*subscribers);
+    _subscribers = std::move(subscribers);
+}
@@ -4,11 +4,13 @@
 #define ICESTORM_TOPIC_I_H
 
 #include "Election.h"
+#include "EventLog.h"
 #include "Ice/ObserverHelper.h"
 #include "IceStormInternal.h"
 #include "Instrumentation.h"
 #include "Util.h"
 
+#include <functional>
 #include <list>
 
 namespace IceStorm
@@ -48,7 +50,7 @@ namespace IceStorm
         [[nodiscard]] Ice::Identity id() const;
         [[nodiscard]] TopicPrx proxy() const;
         void shutdown();
-        void publish(bool, const EventDataSeq&);
+        void publish(bool, EventDataSeq);
 
         // Observer methods.
         void observerAddSubscriber(const IceStormElection::LogUpdate&, const SubscriberRecord&);
@@ -66,6 +68,9 @@ namespace IceStorm
         IceStormElection::LogUpdate destroyInternal(const IceStormElection::LogUpdate&, bool);
         void removeSubscribers(const Ice::IdentitySeq&);
 
+        // Replaces the subscribers with a copy updated by the given function. Must be called with the mutex locked.
+        void updateSubscribers(const std::function<void(std::vector<std::shared_ptr<Subscriber>>&)>&);
+
         //
         // Immutable members.
         //
@@ -73,6 +78,9 @@ namespace IceStorm
         const std::string _name; // The topic name
         const Ice::Identity _id; // The topic identity
 
+        // The event log, or nullptr if the events of this topic are not logged.
+        const std::shared_ptr<EventLog> _eventLog;
+
         IceInternal::ObserverHelperT<IceStorm::Instrumentation::TopicObserver> _observer;
 
         std::optional<Ice::ObjectPrx> _publisherPrx; // The actual publisher proxy.
@@ -90,7 +98,10 @@ namespace IceStorm
         // vector/list/map and although there was little difference vector
         // was the fastest of the three.
         //
-        std::vector<std::shared_ptr<Subscriber>> _subscribers;
+        // The vector is immutable: updateSubscribers replaces it with an updated copy. Publishers keep a reference to
+        // the vector with the mutex locked, then publish to its subscribers with the mutex unlocked.
+        //
+        std::shared_ptr<const std::vector<std::shared_ptr<Subscriber>>> _subscribers;
 
         bool _destroyed{false}; // Has this Topic been destroyed?
 
@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "TransientTopicI.h"
+#include "EventLog.h"
 #include "Ice/Ice.h"
 #include "Instance.h"
 #include "Subscriber.h"
@@ -34,7 +35,7 @@ namespace
 
             EventDataSeq v;
             v.push_back(std::move(event));
-            _impl->publish(false, v);
+            _impl->publish(false, std::move(v));
 
             return true;
         }
@@ -52,7 +53,7 @@ namespace
     public:
         TransientTopicLinkI(shared_ptr<TransientTopicImpl> impl) : _impl(std::move(impl)) {}
 
-        void forward(EventDataSeq v, const Ice::Current&) override { _impl->publish(true, v); }
+        void forward(EventDataSeq v, const Ice::Current&) override { _impl->publish(true, std::move(v)); }
 
     private:
         const shared_ptr<TransientTopicImpl> _impl;
@@ -102,7 +103,8 @@ TransientTopicImpl::create(const shared_ptr<Instance>& instance, const std::stri
 TransientTopicImpl::TransientTopicImpl(shared_ptr<Instance> instance, std::string name, Ice::Identity id)
     : _instance(std::move(instance)),
       _name(std::move(name)),
-      _id(std::move(id))
+      _id(std::move(id)),
+      _subscribers(make_shared<const vector<shared_ptr<Subscriber>>>())
 {
 }
 
@@ -154,6 +156,11 @@ TransientTopicImpl::subscribeAndGetPublisher(QoS qos, optional<Ice::ObjectPrx> o
         }
     }
 
+    if (EventLog::getReplayPosition(qos))
+    {
+        throw BadQoS("topic `" + _name + "' doesn't have an event log to replay");
+    }
+
     lock_guard lock(_mutex);
 
     SubscriberRecord record;
@@ -164,13 +171,13 @@ TransientTopicImpl::subscribeAndGetPublisher(QoS qos, optional<Ice::ObjectPrx> o
     record.link = false;
     record.cost = 0;
 
-    if (find(_subscribers.begin(), _subscribers.end(), record.id) != _subscribers.end())
+    if (find(_subscribers->begin(), _subscribers->end(), record.id) != _subscribers->end())
     {
         throw AlreadySubscribed();
     }
 
     auto subscriber = Subscriber::create(_instance, record);
-    _subscribers.push_back(subscriber);
+    updateSubscribers([&subscriber](auto& subscribers) { subscribers.push_back(subscriber); });
 
     return subscriber->proxy();
 }
@@ -197,12 +204,7 @@ TransientTopicImpl::unsubscribe(optional<Ice::ObjectPrx> subscriber, const Ice::
     // First remove the subscriber from the subscribers list. Note
     // that its possible that the subscriber isn't in the list, but is
     // in the database if the subscriber was locally reaped.
-    auto p = find(_subscribers.begin(), _subscribers.end(), id);
-    if (p != _subscribers.end())
-    {
-        (*p)->destroy();
-        _subscribers.erase(p);
-    }
+    removeSubscribers(Ice::IdentitySeq{id});
 }
 
 optional<TopicLinkPrx>
@@ -240,13 +242,13 @@ TransientTopicImpl::link(optional<TopicPrx> topic, int cost, const Ice::Current&
     record.link = true;
     record.cost = cost;
 
-    if (find(_subscribers.begin(), _subscribers.end(), record.id) != _subscribers.end())
+    if (find(_subscribers->begin(), _subscribers->end(), record.id) != _subscribers->end())
     {
         throw LinkExists(IceStormInternal::identityToTopicName(id));
     }
 
     auto subscriber = Subscriber::create(_instance, record);
-    _subscribers.push_back(subscriber);
+    updateSubscribers([&subscriber](auto& subscribers) { subscribers.push_back(subscriber); });
 }
 
 void
@@ -262,7 +264,7 @@ TransientTopicImpl::unlink(optional<TopicPrx> topic, const Ice::Current&)
     auto id = topic->ice_getIdentity();
     auto traceLevels = _instance->traceLevels();
 
-    if (find(_subscribers.begin(), _subscribers.end(), id) == _subscribers.end())
+    if (find(_subscribers->begin(), _subscribers->end(), id) == _subscribers->end())
     {
         string name = IceStormInternal::identityToTopicName(id);
 
@@ -283,12 +285,7 @@ TransientTopicImpl::unlink(optional<TopicPrx> topic, const Ice::Current&)
     // Remove the subscriber from the subscribers list. Note
     // that its possible that the subscriber isn't in the list, but is
     // in the database if the subscriber was locally reaped.
-    auto p = find(_subscribers.begin(), _subscribers.end(), id);
-    if (p != _subscribers.end())
-    {
-        (*p)->destroy();
-        _subscribers.erase(p);
-    }
+    removeSubscribers(Ice::IdentitySeq{id});
 }
 
 LinkInfoSeq
@@ -297,7 +294,7 @@ TransientTopicImpl::getLinkInfoSeq(const Ice::Current&) const
     lock_guard lock(_mutex);
 
     LinkInfoSeq seq;
-    for (const auto& subscriber : _subscribers)
+    for (const auto& subscriber : *_subscribers)
     {
         SubscriberRecord record = subscriber->record();
         if (record.link && !subscriber->errored())
@@ -318,7 +315,7 @@ TransientTopicImpl::getSubscribers(const Ice::Current&) const
     lock_guard lock(_mutex);
 
     Ice::IdentitySeq subscribers;
-    for (const auto& subscriber : _subscribers)
+    for (const auto& subscriber : *_subscribers)
     {
         subscribers.push_back(subscriber->id());
     }
@@ -354,11 +351,15 @@ TransientTopicImpl::destroy(const Ice::Current&)
     }
 
     // Destroy all of the subscribers.
-    for (const auto& subscriber : _subscribers)
-    {
-        subscriber->destroy();
-    }
-    _subscribers.clear();
+    updateSubscribers(
+        [](auto& subscribers)
+        {
+            for (const auto& subscriber : subscribers)
+            {
+                subscriber->destroy();
+            }
+            subscribers.clear();
+        });
 }
 
 void
@@ -381,30 +382,23 @@ TransientTopicImpl::id() const
 }
 
 void
-TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
+TransientTopicImpl::publish(bool forwarded, EventDataSeq events)
 {
     //
-    // Copy of the subscriber list so that event publishing can occur
+    // Snapshot of the subscriber list so that event publishing can occur
     // in parallel.
     //
-    vector<shared_ptr<Subscriber>> copy;
+    shared_ptr<const vector<shared_ptr<Subscriber>>> subscribers;
     {
         lock_guard lock(_mutex);
-        copy = _subscribers;
+        subscribers = _subscribers;
     }
 
     //
     // Queue each event, gathering a list of those subscribers that
-    // must be reaped.
+    // must be reaped. The events are shared by all the subscribers.
     //
-    vector<Ice::Identity> ids;
-    for (const auto& subscriber : copy)
-    {
-        if (!subscriber->queue(forwarded, events) && subscriber->reap())
-        {
-            ids.push_back(subscriber->id());
-        }
-    }
+    Ice::IdentitySeq ids = queueEvents(*_instance, *subscribers, forwarded, shareEvents(std::move(events)));
 
     //
     // Run through the error list removing those subscribers that are
@@ -413,32 +407,7 @@ TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
     if (!ids.empty())
     {
         lock_guard lock(_mutex);
-        for (const auto& id : ids)
-        {
-            //
-            // Its possible for the subscriber to already have been
-            // removed since the copy is iterated over outside of
-            // mutex protection.
-            //
-            // Note that although this could be quicker if we used a
-            // map, the most optimal case should be pushing around
-            // events not searching for a particular subscriber.
-            //
-            // The subscriber is immediately destroyed & removed from
-            // the _subscribers list. Add the subscriber to a list of
-            // error'd subscribers and remove it from the database on
-            // the next reap.
-            //
-            auto q = find(_subscribers.begin(), _subscribers.end(), id);
-            if (q != _subscribers.end())
-            {
-                //
-                // Destroy the subscriber.
-                //
-                (*q)->destroy();
-                _subscribers.erase(q);
-            }
-        }
+        removeSubscribers(ids);
     }
 }
 
@@ -448,8 +417,43 @@ TransientTopicImpl::shutdown()
     lock_guard lock(_mutex);
 
     // Shutdown each subscriber. This waits for the event queues to drain.
-    for (const auto& subscriber : _subscribers)
+    for (const auto& subscriber : *_subscribers)
     {
         subscriber->shutdown();
     }
 }
+
+void
+TransientTopicImpl::updateSubscribers(const function<void(vector<shared_ptr<Subscriber>>&)>& update)
+{
+    auto subscribers = make_shared<vector<shared_ptr<Subscriber>>>(*_subscribers);
+    update(*subscribers);
+    _subscribers = std::move(subscribers);
+}
+
+void
+TransientTopicImpl::removeSubscribers(const Ice::IdentitySeq& ids)
+{
+    updateSubscribers(
+        [&ids](auto& subscribers)
+        {
+            for (const auto& id : ids)
+            {
+                //
+                // Its possible for the subscriber to already have been
+                // removed since the copy is iterated over outside of
+                // mutex protection.
+                //
+                // Note that although this could be quicker if we used a
+                // map, the most optimal case should be pushing around
+                // events not searching for a particular subscriber.
+                //
+                auto p = find(subscribers.begin(), subscribers.end(), id);
+                if (p != subscribers.end())
+                {
+                    (*p)->destroy();
+                    subscribers.erase(p);
+                }
+            }
+        });
+}
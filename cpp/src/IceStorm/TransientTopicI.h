@@ -5,6 +5,8 @@
 
 #include "IceStormInternal.h"
 
+#include <functional>
+
 namespace IceStorm
 {
     // Forward declarations.
@@ -34,13 +36,17 @@ namespace IceStorm
         // Internal methods
         [[nodiscard]] bool destroyed() const;
         [[nodiscard]] Ice::Identity id() const;
-        void publish(bool, const EventDataSeq&);
+        void publish(bool, EventDataSeq);
 
         void shutdown();
 
     private:
         TransientTopicImpl(std::shared_ptr<Instance>, std::string, Ice::Identity);
 
+        // Replaces the subscribers with a copy updated by the given function. Must be called with the mutex locked.
+        void updateSubscribers(const std::function<void(std::vector<std::shared_ptr<Subscriber>>&)>&);
+        void removeSubscribers(const Ice::IdentitySeq&);
+
         //
         // Immutable members.
         //
@@ -58,7 +64,10 @@ namespace IceStorm
         // vector/list/map and although there was little difference vector
         // was the fastest of the three.
         //
-        std::vector<std::shared_ptr<Subscriber>> _subscribers;
+        // The vector is immutable: updateSubscribers replaces it with an updated copy. Publishers keep a reference to
+        // the vector with the mutex locked, then publish to its subscribers with the mutex unlocked.
+        //
+        std::shared_ptr<const std::vector<std::shared_ptr<Subscriber>>> _subscribers;
 
         bool _destroyed{false}; // Has this Topic been destroyed?
 
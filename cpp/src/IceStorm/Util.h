@@ -5,6 +5,7 @@
 
 #include "../IceDB/IceDB.h"
 #include "Ice/Ice.h"
+#include "IceStormInternal.h"
 #include "LLURecord.h"
 #include "SubscriberRecord.h"
 
@@ -18,6 +19,8 @@ namespace IceStorm
     using SubscriberMap =
         IceDB::Dbi<IceStorm::SubscriberRecordKey, IceStorm::SubscriberRecord, IceDB::IceContext, Ice::OutputStream>;
     using LLUMap = IceDB::Dbi<std::string, IceStormElection::LogUpdate, IceDB::IceContext, Ice::OutputStream>;
+    using EventMap = IceDB::Dbi<IceStorm::EventRecordKey, IceStorm::EventRecord, IceDB::IceContext, Ice::OutputStream>;
+    using EventOffsetMap = IceDB::Dbi<std::string, std::int64_t, IceDB::IceContext, Ice::OutputStream>;
 
     const char* const lluDbKey = "_manager";
 }
@@ -32,6 +35,8 @@ namespace IceStormInternal
 
     int compareSubscriberRecordKey(const MDB_val* v1, const MDB_val* v2);
 
+    int compareEventRecordKey(const MDB_val* v1, const MDB_val* v2);
+
     IceStormElection::LogUpdate getIncrementedLLU(const IceDB::ReadWriteTxn&, IceStorm::LLUMap&);
 }
 
@@ -54,7 +54,11 @@ namespace
         }
         else
         {
-            assert(strType == "string" || strType == "wstring");
+            assert(strType == "string" || strType == "wstring" || strType == "pmr::string");
+            if ((typeCtx & TypeContext::MarshalParam) != TypeContext::None && strType == "pmr::string")
+            {
+                return "std::string_view";
+            }
             strType = "std::" + strType;
         }
 
@@ -662,12 +666,18 @@ Slice::writeAllocateCode(
     const ParameterList& params,
     const OperationPtr& op,
     const string& clScope,
-    TypeContext typeCtx)
+    TypeContext typeCtx,
+    bool useStreamMemoryResource)
 {
     for (const auto& param : params)
     {
         string s = typeToString(param->type(), param->optional(), clScope, param->getMetadata(), typeCtx);
-        out << nl << s << ' ' << paramPrefix << param->mappedName() << ';';
+        out << nl << s << ' ' << paramPrefix << param->mappedName();
+        if (useStreamMemoryResource)
+        {
+            out << " = IceInternal::makeWithMemoryResource<" << s << ">(istr->getMemoryResource())";
+        }
+        out << ';';
     }
 
     if (op && op->returnType())
@@ -55,8 +55,16 @@ namespace Slice
 
     void writeMarshalCode(IceInternal::Output&, const ParameterList&, const OperationPtr&);
     void writeUnmarshalCode(IceInternal::Output&, const ParameterList&, const OperationPtr&);
-    void
-    writeAllocateCode(IceInternal::Output&, const ParameterList&, const OperationPtr&, const std::string&, TypeContext);
+
+    /// Declares the variables of the parameters. If useStreamMemoryResource is true, the std::pmr strings and containers
+    /// are constructed with the memory resource of the input stream `istr`.
+    void writeAllocateCode(
+        IceInternal::Output&,
+        const ParameterList&,
+        const OperationPtr&,
+        const std::string&,
+        TypeContext,
+        bool useStreamMemoryResource = false);
 
     /// Writes the StreamReader specialization for a struct.
     void writeStreamReader(IceInternal::Output&, const StructPtr&, const DataMemberList&);
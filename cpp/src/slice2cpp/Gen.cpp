@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <set>
 #include <string>
 
 using namespace std;
@@ -70,6 +71,92 @@ namespace
         }
     }
 
+    // Returns true if the given type is a fixed-size integral or floating-point type, or a struct whose fields are all
+    // such types. The C++ mapping of these types holds the exact values of their encoding.
+    bool isFixedSizeNumericType(const TypePtr& type)
+    {
+        BuiltinPtr bp = dynamic_pointer_cast<Builtin>(type);
+        if (bp)
+        {
+            switch (bp->kind())
+            {
+                case Builtin::KindByte:
+                case Builtin::KindShort:
+                case Builtin::KindInt:
+                case Builtin::KindLong:
+                case Builtin::KindFloat:
+                case Builtin::KindDouble:
+                {
+                    return true;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            StructPtr s = dynamic_pointer_cast<Struct>(type);
+            if (s)
+            {
+                DataMemberList members = s->dataMembers();
+                for (const auto& member : members)
+                {
+                    if (!isFixedSizeNumericType(member->type()))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            return false;
+        }
+    }
+
+    // Computes the 64-bit FNV-1a hash of an operation name, this must match IceInternal::operationHash.
+    uint64_t operationHash(const string& operation)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (char c : operation)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // Returns true if an interface defined in this container, or one of its operations, has the given metadata.
+    bool hasOperationMetadata(const ContainerPtr& container, string_view directive)
+    {
+        for (const auto& interfaceDef : container->interfaces())
+        {
+            if (interfaceDef->includeLevel() == 0)
+            {
+                if (interfaceDef->hasMetadata(directive))
+                {
+                    return true;
+                }
+                for (const auto& op : interfaceDef->operations())
+                {
+                    if (op->hasMetadata(directive))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+
+        for (const auto& module : container->modules())
+        {
+            if (hasOperationMetadata(module, directive))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     string getDeprecatedAttribute(const ContainedPtr& p1)
     {
         string deprecatedAttribute;
@@ -825,6 +912,14 @@ Slice::Gen::generate(const UnitPtr& p)
     C << "\n#include <Ice/OutgoingAsync.h>";        // for proxies
     C << "\n#include <algorithm>";                  // for the dispatch implementation
     C << "\n#include <array>";                      // for the dispatch implementation
+    if (hasOperationMetadata(p, "cpp:arena"))
+    {
+        C << "\n#include <Ice/UnmarshalArena.h>"; // for dispatches with cpp:arena
+    }
+    if (hasOperationMetadata(p, "cpp:direct-collocation"))
+    {
+        C << "\n#include <Ice/DirectDispatch.h>"; // for invocations with cpp:direct-collocation
+    }
 
     // Disable shadow and deprecation warnings in .cpp file
     C << sp;
@@ -915,6 +1010,26 @@ Slice::Gen::validateMetadata(const UnitPtr& u)
     };
     knownMetadata.emplace("cpp:array", std::move(arrayInfo));
 
+    // "cpp:arena"
+    // The std::pmr in-parameters of the dispatch are allocated in an arena released when the dispatch function returns:
+    // they must not be stored beyond the dispatch (see IceInternal::UnmarshalArena).
+    MetadataInfo arenaInfo = {
+        .validOn = {typeid(InterfaceDecl), typeid(Operation)},
+        .acceptedArgumentKind = MetadataArgumentKind::NoArguments,
+        .extraValidation = [](const MetadataPtr&, const SyntaxTreeBasePtr& p) -> optional<string>
+        {
+            // The arena is released when the dispatch function returns, which is too early for AMD operations.
+            auto op = dynamic_pointer_cast<Operation>(p);
+            ContainedPtr contained = op ? ContainedPtr{op->interface()} : dynamic_pointer_cast<Contained>(p);
+            if ((op && op->hasMetadata("amd")) || contained->hasMetadata("amd"))
+            {
+                return "ignoring 'cpp:arena' metadata: it cannot be applied to AMD operations";
+            }
+            return nullopt;
+        },
+    };
+    knownMetadata.emplace("cpp:arena", std::move(arenaInfo));
+
     // "cpp:const"
     MetadataInfo constInfo = {
         .validOn = {typeid(Operation)},
@@ -944,6 +1059,31 @@ Slice::Gen::validateMetadata(const UnitPtr& u)
         }};
     knownMetadata.emplace("cpp:ice_print", std::move(icePrintInfo));
 
+    // "cpp:direct-collocation"
+    // The synchronous proxy function calls the collocated servant directly when possible (see
+    // IceInternal::DirectDispatch). The servant of an AMD operation or of an operation with a marshaled result can't
+    // be called directly.
+    MetadataInfo directCollocationInfo = {
+        .validOn = {typeid(InterfaceDecl), typeid(Operation)},
+        .acceptedArgumentKind = MetadataArgumentKind::NoArguments,
+        .extraValidation = [](const MetadataPtr&, const SyntaxTreeBasePtr& p) -> optional<string>
+        {
+            auto op = dynamic_pointer_cast<Operation>(p);
+            ContainedPtr contained = op ? ContainedPtr{op->interface()} : dynamic_pointer_cast<Contained>(p);
+            if ((op && op->hasMetadata("amd")) || contained->hasMetadata("amd"))
+            {
+                return "ignoring 'cpp:direct-collocation' metadata: it cannot be applied to AMD operations";
+            }
+            if ((op && op->hasMarshaledResult()) || (!op && contained->hasMetadata("marshaled-result")))
+            {
+                return "ignoring 'cpp:direct-collocation' metadata: it cannot be applied to operations with a "
+                       "marshaled result";
+            }
+            return nullopt;
+        },
+    };
+    knownMetadata.emplace("cpp:direct-collocation", std::move(directCollocationInfo));
+
     // "cpp:dll-export"
     MetadataInfo dllExportInfo = {
         .validOn = {typeid(Unit)},
@@ -1045,7 +1185,8 @@ Slice::Gen::validateMetadata(const UnitPtr& u)
 
     // "cpp:type"
     // Validating 'cpp:type' is painful with this system because it is used to support 2 completely separate use-cases.
-    // One for switching between wide and narrow strings, and another for customizing the mapping of sequences/dicts.
+    // One for switching between wide, narrow and std::pmr strings, and another for customizing the mapping of
+    // sequences/dicts.
     // Thankfully, there is no overlap in what these can be applied to, but having separate cases like this still means
     // the validation framework isn't useful here. So, we turn off almost everything, and use a custom function instead.
     MetadataInfo typeInfo = {
@@ -1071,7 +1212,7 @@ Slice::Gen::validateMetadata(const UnitPtr& u)
             if (auto builtin = dynamic_pointer_cast<Builtin>(p); builtin && builtin->kind() == Builtin::KindString)
             {
                 const string& argument = meta->arguments();
-                if (argument != "string" && argument != "wstring")
+                if (argument != "string" && argument != "wstring" && argument != "pmr::string")
                 {
                     return "invalid argument '" + argument + "' supplied to 'cpp:type' metadata in this context";
                 }
@@ -1776,6 +1917,7 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     C << nl << retSImpl << nl << prxScopedOpName << spar << paramsImplDecl << "const Ice::Context& context" << epar
       << " const";
     C << sb;
+    emitDirectCollocation(p);
     C << nl;
     if (futureOutParams.size() == 1)
     {
@@ -2050,6 +2192,82 @@ Slice::Gen::ProxyVisitor::emitOperationImpl(
     C << ");" << eb;
 }
 
+void
+Slice::Gen::ProxyVisitor::emitDirectCollocation(const OperationPtr& p)
+{
+    const InterfaceDefPtr container = p->interface();
+    if (!container->hasMetadata("cpp:direct-collocation") && !p->hasMetadata("cpp:direct-collocation"))
+    {
+        return;
+    }
+
+    // The servant of an AMD operation or of an operation with a marshaled result can't be called directly.
+    if (container->hasMetadata("amd") || p->hasMetadata("amd") || p->hasMarshaledResult())
+    {
+        return;
+    }
+
+    const string interfaceScope = container->mappedScope();
+    const TypePtr ret = p->returnType();
+
+    // The servant receives its in-parameters by value: the in-parameters mapped to another type by the proxy, such as
+    // strings passed as string views, are converted explicitly. An in-parameter with a view type can't be converted.
+    vector<string> args;
+    for (const auto& q : p->parameters())
+    {
+        const string prefixedParamName = paramPrefix + q->mappedName();
+        if (q->isOutParam())
+        {
+            args.push_back(prefixedParamName);
+            continue;
+        }
+
+        if (q->hasMetadata("cpp:view-type"))
+        {
+            return;
+        }
+
+        const string proxyType = typeToString(
+            q->type(),
+            q->optional(),
+            interfaceScope,
+            q->getMetadata(),
+            _useWstring | TypeContext::MarshalParam);
+        const string servantType = typeToString(
+            q->type(),
+            q->optional(),
+            interfaceScope,
+            q->getMetadata(),
+            _useWstring | TypeContext::UnmarshalParamZeroCopy);
+        args.push_back(proxyType == servantType ? prefixedParamName : servantType + "{" + prefixedParamName + "}");
+    }
+    args.emplace_back("direct.current()");
+
+    C << nl << "IceInternal::DirectDispatch direct{*this, \"" << p->name() << "\", " << operationModeToString(p->mode())
+      << ", context};";
+    C << nl << "if (auto* servant = direct.servant<" << container->mappedScoped() << ">())";
+    C << sb;
+    C << nl << "try";
+    C << sb;
+    C << nl << (ret ? "return " : "") << "servant->" << p->mappedName() << spar << args << epar << ";";
+    if (!ret)
+    {
+        C << nl << "return;";
+    }
+    C << eb;
+    C << nl << "catch (...)";
+    C << sb;
+    C << nl << "direct.rethrow(";
+    C.inc();
+    C << nl << "std::current_exception(),";
+    C << nl;
+    throwUserExceptionLambda(C, p->throws(), interfaceScope);
+    C << ");";
+    C.dec();
+    C << eb;
+    C << eb;
+}
+
 Slice::Gen::DataDefVisitor::DataDefVisitor(IceInternal::Output& h, IceInternal::Output& c, string dllExport)
     : H(h),
       C(c),
@@ -2932,48 +3150,83 @@ Slice::Gen::InterfaceVisitor::visitInterfaceDefEnd(const InterfaceDefPtr& p)
              "sendResponse)";
         C << sb;
 
-        C << sp;
-        C << nl << "static constexpr std::array<std::string_view, " << allOpNames.size() << "> allOperations";
-        C.spar("{");
+        set<uint64_t> hashes;
         for (const auto& opNames : allOpNames)
         {
-            C << '"' + opNames.first + '"';
+            hashes.insert(operationHash(opNames.first));
         }
-        C.epar("}");
-        C << ";";
 
         C << sp;
         C << nl << "const Ice::Current& current = request.current();";
-        C << nl << "auto r = std::equal_range(allOperations.begin(), allOperations.end(), current.operation);";
-        // range is a C++ 20 feature and we want to keep the generated code C++17 compatible and lint-free.
-        C << " // NOLINT(modernize-use-ranges)";
-        C << nl << "if (r.first == r.second)";
-        C << sb;
-        C << nl
-          << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
-             "FILE__, __LINE__}), current));";
-        C << nl << "return;";
-        C << eb;
-        C << sp;
-        C << nl << "switch (r.first - allOperations.begin())";
-        C << sb;
-        int i = 0;
-        for (const auto& opNames : allOpNames)
+        if (hashes.size() == allOpNames.size())
         {
-            C << nl << "case " << i++ << ':';
+            // Switch on the hash of the operation name, and check the name of the operation with this hash.
+            C << nl << "switch (IceInternal::operationHash(current.operation))";
+            C << sb;
+            for (const auto& opNames : allOpNames)
+            {
+                C << nl << "case IceInternal::operationHash(\"" << opNames.first << "\"):";
+                C << sb;
+                C << nl << "if (current.operation == \"" << opNames.first << "\")";
+                C << sb;
+                C << nl << "_iceD_" << opNames.second << "(request, std::move(sendResponse));";
+                C << nl << "return;";
+                C << eb;
+                C << nl << "break;";
+                C << eb;
+            }
+            C << nl << "default:";
             C << sb;
-            C << nl << "_iceD_" << opNames.second << "(request, std::move(sendResponse));";
             C << nl << "break;";
             C << eb;
+            C << eb;
+            C << nl
+              << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
+                 "FILE__, __LINE__}), current));";
+        }
+        else
+        {
+            // Several operation names have the same hash, we look up the operation with a binary search.
+            C << nl << "static constexpr std::array<std::string_view, " << allOpNames.size() << "> allOperations";
+            C.spar("{");
+            for (const auto& opNames : allOpNames)
+            {
+                C << '"' + opNames.first + '"';
+            }
+            C.epar("}");
+            C << ";";
+
+            C << nl << "auto r = std::equal_range(allOperations.begin(), allOperations.end(), current.operation);";
+            // range is a C++ 20 feature and we want to keep the generated code C++17 compatible and lint-free.
+            C << " // NOLINT(modernize-use-ranges)";
+            C << nl << "if (r.first == r.second)";
+            C << sb;
+            C << nl
+              << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
+                 "FILE__, __LINE__}), current));";
+            C << nl << "return;";
+            C << eb;
+            C << sp;
+            C << nl << "switch (r.first - allOperations.begin())";
+            C << sb;
+            int i = 0;
+            for (const auto& opNames : allOpNames)
+            {
+                C << nl << "case " << i++ << ':';
+                C << sb;
+                C << nl << "_iceD_" << opNames.second << "(request, std::move(sendResponse));";
+                C << nl << "break;";
+                C << eb;
+            }
+            C << nl << "default:";
+            C << sb;
+            C << nl << "assert(false);";
+            C << nl
+              << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
+                 "FILE__, __LINE__}), current));";
+            C << eb;
+            C << eb;
         }
-        C << nl << "default:";
-        C << sb;
-        C << nl << "assert(false);";
-        C << nl
-          << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
-             "FILE__, __LINE__}), current));";
-        C << eb;
-        C << eb;
         C << eb;
     }
 
@@ -3236,7 +3489,19 @@ Slice::Gen::InterfaceVisitor::visitOperation(const OperationPtr& p)
     {
         C << nl << "auto istr = &request.inputStream();";
         C << nl << "istr->startEncapsulation();";
-        writeAllocateCode(C, inParams, nullptr, interfaceScope, _useWstring | TypeContext::UnmarshalParamZeroCopy);
+        bool arena = !amd && (container->hasMetadata("cpp:arena") || p->hasMetadata("cpp:arena"));
+        if (arena)
+        {
+            // The std::pmr parameters are constructed with an arena that lives until the end of the dispatch.
+            C << nl << "IceInternal::UnmarshalArena arena{istr};";
+        }
+        writeAllocateCode(
+            C,
+            inParams,
+            nullptr,
+            interfaceScope,
+            _useWstring | TypeContext::UnmarshalParamZeroCopy,
+            arena);
         writeUnmarshalCode(C, inParams, nullptr);
         if (p->sendsClasses())
         {
@@ -3392,6 +3657,7 @@ Slice::Gen::StreamVisitor::visitStructStart(const StructPtr& p)
     H << nl << "static constexpr StreamHelperCategory helper = StreamHelperCategoryStruct;";
     H << nl << "static constexpr int minWireSize = " << p->minWireSize() << ";";
     H << nl << "static constexpr bool fixedLength = " << (p->isVariableLength() ? "false" : "true") << ";";
+    H << nl << "static constexpr bool fixedSizeNumeric = " << (isFixedSizeNumericType(p) ? "true" : "false") << ";";
     H << eb << ";";
     H << sp;
 
@@ -122,6 +122,10 @@ namespace Slice
                 const std::string& prefix,
                 const std::vector<std::string>& outgoingAsyncParams);
 
+            /// Generates the direct call to the collocated servant of an operation with the
+            /// "cpp:direct-collocation" metadata, at the start of its synchronous proxy function.
+            void emitDirectCollocation(const OperationPtr& p);
+
             IceInternal::Output& H;
             IceInternal::Output& C;
 
@@ -135,6 +135,8 @@ CallbackReceiverI::answerConcurrentCallbacks(unsigned int num)
     _callbacks.clear();
 }
 
+CallbackI::CallbackI(shared_ptr<CallbackNumbers> numbers) : _numbers(std::move(numbers)) {}
+
 void
 CallbackI::initiateCallbackAsync(
     optional<CallbackReceiverPrx> proxy,
@@ -203,6 +205,22 @@ CallbackI::initiateCallbackWithPayloadAsync(
     proxy->callbackWithPayloadAsync(seq, std::move(response), std::move(error), nullptr, current.ctx);
 }
 
+void
+CallbackI::addNumber(int number, const Current&)
+{
+    lock_guard<mutex> lg(_numbers->mutex);
+    _numbers->numbers.push_back(number);
+}
+
+IntSeq
+CallbackI::getNumbers(const Current&)
+{
+    lock_guard<mutex> lg(_numbers->mutex);
+    IntSeq numbers;
+    numbers.swap(_numbers->numbers);
+    return numbers;
+}
+
 void
 CallbackI::shutdown(const Ice::Current& current)
 {
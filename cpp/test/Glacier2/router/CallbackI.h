@@ -35,9 +35,18 @@ private:
     std::condition_variable _condVar;
 };
 
+// The numbers added by the addNumber calls on the callback objects of the server.
+struct CallbackNumbers
+{
+    Ice::IntSeq numbers;
+    std::mutex mutex;
+};
+
 class CallbackI final : public ::Test::Callback
 {
 public:
+    explicit CallbackI(std::shared_ptr<CallbackNumbers>);
+
     void initiateCallbackAsync(
         std::optional<Test::CallbackReceiverPrx>,
         std::function<void()>,
@@ -69,7 +78,13 @@ public:
         std::function<void(std::exception_ptr)>,
         const Ice::Current&) override;
 
+    void addNumber(int, const Ice::Current&) override;
+    Ice::IntSeq getNumbers(const Ice::Current&) override;
+
     void shutdown(const Ice::Current&) override;
+
+private:
+    const std::shared_ptr<CallbackNumbers> _numbers;
 };
 
 #endif
@@ -680,6 +680,30 @@ CallbackClient::run(int argc, char** argv)
         cout << "ok" << endl;
     }
 
+    {
+        //
+        // The oneway requests to several targets are received in the order they were sent, including when the router
+        // batches them.
+        //
+        cout << "testing oneway requests order with several targets... " << flush;
+        Context context;
+        context["_fwd"] = "o";
+        vector<CallbackPrx> targets{
+            twoway->ice_oneway(),
+            twoway->ice_identity<CallbackPrx>(stringToIdentity("c2/callback"))->ice_oneway(),
+            twoway->ice_identity<CallbackPrx>(stringToIdentity("_userid/callback"))->ice_oneway()};
+        const size_t pattern[] = {0, 1, 0, 2, 2, 1, 0, 1, 2, 0};
+        twoway->getNumbers();
+        IntSeq numbers;
+        for (int i = 0; i < 100; ++i)
+        {
+            targets[pattern[static_cast<size_t>(i) % size(pattern)]]->addNumber(i, context);
+            numbers.push_back(i);
+        }
+        test(twoway->getNumbers() == numbers);
+        cout << "ok" << endl;
+    }
+
     {
         cout << "testing with blocking clients... " << flush;
 
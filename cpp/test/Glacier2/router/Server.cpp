@@ -23,11 +23,12 @@ CallbackServer::run(int argc, char** argv)
     Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
     communicator->getProperties()->setProperty("CallbackAdapter.Endpoints", getTestEndpoint());
     auto adapter = communicator->createObjectAdapter("CallbackAdapter");
-    adapter->add(make_shared<CallbackI>(), Ice::stringToIdentity("c1/callback")); // The test allows "c1" as category.
-    adapter->add(make_shared<CallbackI>(), Ice::stringToIdentity("c2/callback")); // The test allows "c2" as category.
-    adapter->add(make_shared<CallbackI>(), Ice::stringToIdentity("c3/callback")); // The test rejects "c3" as category.
+    auto numbers = make_shared<CallbackNumbers>();
+    adapter->add(make_shared<CallbackI>(numbers), Ice::stringToIdentity("c1/callback")); // The test allows "c1".
+    adapter->add(make_shared<CallbackI>(numbers), Ice::stringToIdentity("c2/callback")); // The test allows "c2".
+    adapter->add(make_shared<CallbackI>(numbers), Ice::stringToIdentity("c3/callback")); // The test rejects "c3".
     adapter->add(
-        make_shared<CallbackI>(),
+        make_shared<CallbackI>(numbers),
         Ice::stringToIdentity("_userid/callback")); // The test allows the prefixed userid.
     adapter->activate();
     communicator->waitForShutdown();
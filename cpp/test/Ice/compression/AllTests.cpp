@@ -0,0 +1,154 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <mutex>
+
+using namespace std;
+using namespace Ice;
+using namespace Test;
+
+namespace
+{
+    // Records the compression status of the protocol messages, from the protocol traces.
+    class CompressionStatusLogger final : public Ice::Logger, public enable_shared_from_this<CompressionStatusLogger>
+    {
+    public:
+        void print(const string&) final {}
+
+        void trace(const string&, const string& message) final
+        {
+            const string prefix = "compression status = ";
+            auto pos = message.find(prefix);
+            if (pos == string::npos)
+            {
+                return;
+            }
+            auto status = static_cast<uint8_t>(stoi(message.substr(pos + prefix.size())));
+
+            lock_guard lock(_mutex);
+            if (message.find("received validate connection") == 0)
+            {
+                _codecMask = status;
+            }
+            else if (message.find("sending request") == 0)
+            {
+                _requestStatus = status;
+            }
+            else if (message.find("received reply") == 0)
+            {
+                _replyStatus = status;
+            }
+        }
+
+        void warning(const string&) final {}
+        void error(const string&) final {}
+        string getPrefix() final { return "CompressionStatusLogger"; }
+        LoggerPtr cloneWithPrefix(string) final { return shared_from_this(); }
+
+        // The codecs other than bzip2 advertised by the server.
+        uint8_t codecMask()
+        {
+            lock_guard lock(_mutex);
+            return _codecMask;
+        }
+
+        uint8_t requestStatus()
+        {
+            lock_guard lock(_mutex);
+            return _requestStatus;
+        }
+
+        uint8_t replyStatus()
+        {
+            lock_guard lock(_mutex);
+            return _replyStatus;
+        }
+
+    private:
+        mutex _mutex;
+        uint8_t _codecMask{0};
+        uint8_t _requestStatus{0};
+        uint8_t _replyStatus{0};
+    };
+}
+
+void
+allTests(TestHelper* helper)
+{
+    CommunicatorPtr communicator = helper->communicator();
+    string proxyString = "test:" + helper->getTestEndpoint();
+
+    // A large message compresses well, a message smaller than 100 bytes is never compressed.
+    const ByteSeq seq(1000, byte{1});
+
+    const vector<pair<string, uint8_t>> codecs{{"bzip2", 2}, {"zstd", 3}, {"lz4", 4}};
+    for (const auto& [name, compressionStatus] : codecs)
+    {
+        cout << "testing " << name << " codec negotiation... " << flush;
+        {
+            auto logger = make_shared<CompressionStatusLogger>();
+            InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.Compression.Codec", name);
+            initData.properties->setProperty("Ice.Override.Compress", "");
+            initData.properties->setProperty("Ice.Trace.Protocol", "1");
+            initData.logger = logger;
+            CommunicatorHolder ich = initialize(initData);
+
+            TestIntfPrx p(ich.communicator(), proxyString);
+            p = p->ice_compress(true);
+            p->ice_ping();
+
+            // The connection uses the configured codec if the server advertised it, otherwise it falls back to bzip2.
+            // The server always advertises the codecs of its own build, which is also the build of this client.
+            uint8_t expected = compressionStatus;
+            if (compressionStatus > 2 && (logger->codecMask() & (1 << (compressionStatus - 3))) == 0)
+            {
+                expected = 2;
+            }
+
+            // The request is too small to be compressed, the server compresses the reply with the codec of its
+            // connection, which is bzip2 until it receives a compressed request.
+            test(p->getBytes(1000) == seq);
+            test(logger->requestStatus() == 1);
+            test(logger->replyStatus() == 2);
+
+            // The reply is compressed with the codec of the request.
+            test(p->echo(seq) == seq);
+            test(logger->requestStatus() == expected);
+            test(logger->replyStatus() == expected);
+
+            // The server connection now uses the codec of the last compressed request.
+            test(p->getBytes(1000) == seq);
+            test(logger->requestStatus() == 1);
+            test(logger->replyStatus() == expected);
+
+            // Messages sent with a proxy that doesn't compress are never compressed.
+            test(p->ice_compress(false)->echo(seq) == seq);
+            test(logger->requestStatus() == 0);
+            test(logger->replyStatus() == 0);
+        }
+        cout << "ok" << endl;
+    }
+
+    cout << "testing invalid codec... " << flush;
+    {
+        InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Compression.Codec", "gzip");
+        try
+        {
+            initialize(initData);
+            test(false);
+        }
+        catch (const InitializationException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    TestIntfPrx p(communicator, proxyString);
+    p->shutdown();
+}
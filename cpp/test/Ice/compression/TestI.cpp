@@ -0,0 +1,23 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TestI.h"
+
+using namespace std;
+
+Ice::ByteSeq
+TestIntfI::echo(Ice::ByteSeq seq, const Ice::Current&)
+{
+    return seq;
+}
+
+Ice::ByteSeq
+TestIntfI::getBytes(int32_t size, const Ice::Current&)
+{
+    return Ice::ByteSeq(static_cast<size_t>(size), byte{1});
+}
+
+void
+TestIntfI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
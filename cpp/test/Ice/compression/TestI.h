@@ -0,0 +1,16 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+class TestIntfI final : public Test::TestIntf
+{
+public:
+    Ice::ByteSeq echo(Ice::ByteSeq, const Ice::Current&) final;
+    Ice::ByteSeq getBytes(std::int32_t, const Ice::Current&) final;
+    void shutdown(const Ice::Current&) final;
+};
+
+#endif
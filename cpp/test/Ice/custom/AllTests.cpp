@@ -218,6 +218,37 @@ allTests(TestHelper* helper)
         test(ret == in);
     }
 
+    {
+        vector<byte> bytes(1024);
+        for (size_t i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] = static_cast<byte>(i);
+        }
+        SharedByteSeq in(bytes);
+
+        SharedByteSeq out;
+        SharedByteSeq ret = t->opSharedByteSeq(in, out);
+        test(out == in);
+        test(ret == in);
+
+        // The sequences are not copied: they point into the response buffer, where the return value follows the out
+        // parameter and its size (encoded on 5 bytes).
+        test(ret.data() == out.data() + out.size() + 5);
+        test(ret.subseq(10, 100).data() == ret.data() + 10);
+
+        // The unmarshaled sequences refer to the memory of the response and remain valid after other invocations.
+        SharedByteSeq slice = ret.subseq(10, 100);
+        ret = SharedByteSeq{};
+        t->opSharedByteSeq(in, out);
+        test(slice.size() == 100);
+        test(equal(slice.begin(), slice.end(), bytes.begin() + 10));
+        test(slice.toVector() == vector<byte>(bytes.begin() + 10, bytes.begin() + 110));
+
+        SharedByteSeq empty;
+        test(t->opSharedByteSeq(empty, out).empty());
+        test(out.empty());
+    }
+
     {
         deque<string> in(5);
         in[0] = "THESE";
@@ -538,6 +569,85 @@ allTests(TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing std::pmr sequences and strings... " << flush;
+    {
+        QuoteSeq in(10);
+        for (size_t i = 0; i < in.size(); ++i)
+        {
+            in[i].symbol = "SYMBOL-WITH-A-LONG-NAME-" + to_string(i);
+            in[i].price = static_cast<double>(i) / 4;
+            in[i].venues = {"XNAS", "XNYS-WITH-A-LONG-NAME"};
+            in[i].sizes = {{"BID", static_cast<int32_t>(i)}, {"ASK-WITH-A-LONG-NAME", static_cast<int32_t>(i * 2)}};
+        }
+
+        QuoteSeq out;
+        QuoteSeq ret = t->opQuoteSeq(in, out);
+        test(out == in);
+        test(ret == in);
+
+        OutputStream os(communicator);
+        os.write(in);
+        ByteSeq bytes;
+        os.finished(bytes);
+
+        // The strings and containers read from the stream keep their allocator, the memory resource of the stream
+        // is only used for the new std::pmr elements of containers without a polymorphic allocator.
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::monotonic_buffer_resource streamArena;
+        InputStream is(communicator, os.getEncoding(), bytes);
+        is.setMemoryResource(&streamArena);
+        QuoteSeq in2{&arena};
+        is.read(in2);
+        test(in2 == in);
+        test(in2.get_allocator().resource() == &arena);
+        for (const auto& quote : in2)
+        {
+            // The allocator of the sequence doesn't apply to the data members of the structs.
+            test(quote.symbol.get_allocator().resource() == std::pmr::get_default_resource());
+            test(quote.venues.get_allocator().resource() == std::pmr::get_default_resource());
+            test(quote.venues[1].get_allocator().resource() == std::pmr::get_default_resource());
+            test(quote.sizes.begin()->first.get_allocator().resource() == std::pmr::get_default_resource());
+        }
+
+        // Copies use the default memory resource.
+        QuoteSeq copy = in2;
+        test(copy.get_allocator().resource() == std::pmr::get_default_resource());
+
+        vector<string> strings{"A-STRING-LONGER-THAN-THE-SMALL-STRING-BUFFER", "B"};
+        map<string, int32_t> dict{{"A-KEY-LONGER-THAN-THE-SMALL-STRING-BUFFER", 1}, {"B", 2}};
+        OutputStream os2(communicator);
+        os2.write(strings);
+        os2.write(dict);
+        os2.finished(bytes);
+
+        InputStream is2(communicator, os2.getEncoding(), bytes);
+        is2.setMemoryResource(&streamArena);
+        vector<std::pmr::string> strings2;
+        is2.read(strings2);
+        test(strings2.size() == strings.size());
+        for (size_t i = 0; i < strings.size(); ++i)
+        {
+            test(string_view{strings2[i]} == strings[i]);
+            test(strings2[i].get_allocator().resource() == &streamArena);
+        }
+        map<std::pmr::string, int32_t> dict2;
+        is2.read(dict2);
+        test(dict2.size() == dict.size());
+        for (const auto& [key, value] : dict2)
+        {
+            test(dict.at(string{key}) == value);
+            test(key.get_allocator().resource() == &streamArena);
+        }
+
+        // The std::pmr parameters of a cpp:arena operation and their new std::pmr elements use the arena of the
+        // dispatch, which is checked by the servant.
+        t->opPmrParams(
+            "A-STRING-LONGER-THAN-THE-SMALL-STRING-BUFFER",
+            {"A-STRING-LONGER-THAN-THE-SMALL-STRING-BUFFER"},
+            {{"A-KEY-LONGER-THAN-THE-SMALL-STRING-BUFFER", 1}});
+    }
+    cout << "ok" << endl;
+
     cout << "testing alternate sequences with AMI... " << flush;
     {
         {
@@ -65,6 +65,18 @@ TestIntfI::opByteArrayAsync(
     response(in, in);
 }
 
+void
+TestIntfI::opPmrParamsAsync(
+    std::pmr::string,
+    std::vector<std::pmr::string>,
+    std::pmr::map<std::pmr::string, int32_t>,
+    function<void()> response,
+    function<void(exception_ptr)>,
+    const Current&)
+{
+    response();
+}
+
 void
 TestIntfI::opVariableArrayAsync(
     pair<const Variable*, const Variable*> in,
@@ -126,6 +138,16 @@ TestIntfI::opMyByteSeqAsync(
     response(in, in);
 }
 
+void
+TestIntfI::opSharedByteSeqAsync(
+    SharedByteSeq in,
+    function<void(const SharedByteSeq&, const SharedByteSeq&)> response,
+    function<void(exception_ptr)>,
+    const Current&)
+{
+    response(in, in);
+}
+
 void
 TestIntfI::opStringSeqAsync(
     deque<string> in,
@@ -331,6 +353,16 @@ TestIntfI::opBufferStructAsync(
     response(in);
 }
 
+void
+TestIntfI::opQuoteSeqAsync(
+    QuoteSeq in,
+    function<void(const QuoteSeq&, const QuoteSeq&)> response,
+    function<void(exception_ptr)>,
+    const Current&)
+{
+    response(in, in);
+}
+
 void
 TestIntfI::shutdownAsync(function<void()> response, function<void(exception_ptr)>, const Current& current)
 {
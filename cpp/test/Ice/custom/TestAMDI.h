@@ -72,6 +72,12 @@ public:
         std::function<void(std::exception_ptr)>,
         const Ice::Current&) override;
 
+    void opSharedByteSeqAsync(
+        Ice::SharedByteSeq,
+        std::function<void(const Ice::SharedByteSeq&, const Ice::SharedByteSeq&)>,
+        std::function<void(std::exception_ptr)>,
+        const Ice::Current&) override;
+
     void opStringSeqAsync(
         std::deque<std::string>,
         std::function<void(const std::deque<std::string>&, const std::deque<std::string>&)>,
@@ -194,6 +200,20 @@ public:
         std::function<void(std::exception_ptr)>,
         const Ice::Current&) override;
 
+    void opQuoteSeqAsync(
+        Test::QuoteSeq,
+        std::function<void(const Test::QuoteSeq&, const Test::QuoteSeq&)>,
+        std::function<void(std::exception_ptr)>,
+        const Ice::Current&) override;
+
+    void opPmrParamsAsync(
+        std::pmr::string,
+        std::vector<std::pmr::string>,
+        std::pmr::map<std::pmr::string, std::int32_t>,
+        std::function<void()>,
+        std::function<void(std::exception_ptr)>,
+        const Ice::Current&) override;
+
     void shutdownAsync(std::function<void()>, std::function<void(std::exception_ptr)>, const Ice::Current&) override;
 };
 
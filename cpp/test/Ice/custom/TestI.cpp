@@ -113,6 +113,13 @@ TestIntfI::opMyByteSeq(MyByteSeq inSeq, MyByteSeq& outSeq, const Current&)
     return inSeq;
 }
 
+SharedByteSeq
+TestIntfI::opSharedByteSeq(SharedByteSeq inSeq, SharedByteSeq& outSeq, const Current&)
+{
+    outSeq = inSeq;
+    return inSeq;
+}
+
 deque<string>
 TestIntfI::opStringSeq(deque<string> inSeq, deque<string>& outSeq, const Current&)
 {
@@ -257,6 +264,46 @@ TestIntfI::opBufferStruct(BufferStruct bs, const Current&)
     return bs;
 }
 
+QuoteSeq
+TestIntfI::opQuoteSeq(QuoteSeq inSeq, QuoteSeq& outSeq, const Current&)
+{
+    // opQuoteSeq has the cpp:arena metadata: the sequence is constructed with an arena. The data members of the
+    // structs keep the default memory resource.
+    test(inSeq.get_allocator().resource() != std::pmr::get_default_resource());
+    for (const auto& quote : inSeq)
+    {
+        test(quote.symbol.get_allocator().resource() == std::pmr::get_default_resource());
+        test(quote.venues.get_allocator().resource() == std::pmr::get_default_resource());
+    }
+
+    outSeq = inSeq;
+    return inSeq;
+}
+
+void
+TestIntfI::opPmrParams(
+    std::pmr::string inString,
+    std::vector<std::pmr::string> inSeq,
+    std::pmr::map<std::pmr::string, int32_t> inDict,
+    const Current&)
+{
+    // opPmrParams has the cpp:arena metadata: the std::pmr parameters and the std::pmr elements of the other
+    // parameters are constructed with the arena.
+    std::pmr::memory_resource* arena = inString.get_allocator().resource();
+    test(arena != std::pmr::get_default_resource());
+    test(!inSeq.empty());
+    for (const auto& s : inSeq)
+    {
+        test(s.get_allocator().resource() == arena);
+    }
+    test(inDict.get_allocator().resource() == arena);
+    test(!inDict.empty());
+    for (const auto& [key, value] : inDict)
+    {
+        test(key.get_allocator().resource() == arena);
+    }
+}
+
 void
 TestIntfI::shutdown(const Current& current)
 {
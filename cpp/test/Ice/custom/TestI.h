@@ -41,6 +41,8 @@ public:
 
     MyByteSeq opMyByteSeq(MyByteSeq, MyByteSeq&, const Ice::Current&) final;
 
+    Ice::SharedByteSeq opSharedByteSeq(Ice::SharedByteSeq, Ice::SharedByteSeq&, const Ice::Current&) final;
+
     std::deque<std::string> opStringSeq(std::deque<std::string>, std::deque<std::string>&, const Ice::Current&) final;
 
     std::list<std::string> opStringList(std::list<std::string>, std::list<std::string>&, const Ice::Current&) final;
@@ -94,6 +96,14 @@ public:
 
     Test::BufferStruct opBufferStruct(Test::BufferStruct, const Ice::Current&) override;
 
+    Test::QuoteSeq opQuoteSeq(Test::QuoteSeq, Test::QuoteSeq&, const Ice::Current&) override;
+
+    void opPmrParams(
+        std::pmr::string,
+        std::vector<std::pmr::string>,
+        std::pmr::map<std::pmr::string, std::int32_t>,
+        const Ice::Current&) override;
+
     void shutdown(const Ice::Current&) final;
 };
 
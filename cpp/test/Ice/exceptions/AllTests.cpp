@@ -626,6 +626,37 @@ allTests(Test::TestHelper* helper)
 
     cout << "ok" << endl;
 
+    cout << "testing dispatch of operations whose names have the same hash... " << flush;
+    {
+        HashCollisionPrx hashCollision(communicator, "hashCollision:" + helper->getTestEndpoint());
+        test(hashCollision->op5675b8e8a1386f21() == 1);
+        test(hashCollision->op2c13b049b24c46d3() == 2);
+        try
+        {
+            Ice::uncheckedCast<WrongOperationPrx>(hashCollision)->noSuchOperation();
+            test(false);
+        }
+        catch (const Ice::OperationNotExistException& ex)
+        {
+            test(ex.operation() == "noSuchOperation");
+        }
+
+        // HashMatch only implements the first operation: the second operation matches its case in the switch on the
+        // hash of the operation name, but not its name.
+        auto hashMatch = hashCollision->ice_identity<HashCollisionPrx>(Ice::stringToIdentity("hashMatch"));
+        test(hashMatch->op5675b8e8a1386f21() == 1);
+        try
+        {
+            hashMatch->op2c13b049b24c46d3();
+            test(false);
+        }
+        catch (const Ice::OperationNotExistException& ex)
+        {
+            test(ex.operation() == "op2c13b049b24c46d3");
+        }
+    }
+    cout << "ok" << endl;
+
     cout << "catching unknown local exception... " << flush;
 
     try
@@ -27,6 +27,8 @@ Collocated::run(int argc, char** argv)
     Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
     Ice::ObjectPtr object = std::make_shared<ThrowerI>();
     adapter->add(object, Ice::stringToIdentity("thrower"));
+    adapter->add(std::make_shared<HashCollisionI>(), Ice::stringToIdentity("hashCollision"));
+    adapter->add(std::make_shared<HashMatchI>(), Ice::stringToIdentity("hashMatch"));
 
     ThrowerPrx allTests(Test::TestHelper*);
     allTests(this);
@@ -33,6 +33,8 @@ ServerAMD::run(int argc, char** argv)
     adapter->add(object, Ice::stringToIdentity("thrower"));
     adapter2->add(object, Ice::stringToIdentity("thrower"));
     adapter3->add(object, Ice::stringToIdentity("thrower"));
+    adapter->add(std::make_shared<HashCollisionI>(), Ice::stringToIdentity("hashCollision"));
+    adapter->add(std::make_shared<HashMatchI>(), Ice::stringToIdentity("hashMatch"));
     adapter->activate();
     adapter2->activate();
     adapter3->activate();
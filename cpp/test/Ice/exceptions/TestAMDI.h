@@ -101,4 +101,36 @@ public:
     void throwEAsync(std::function<void()>, std::function<void(std::exception_ptr)>, const Ice::Current&) override;
 };
 
+class HashCollisionI final : public Test::HashCollision
+{
+public:
+    void op5675b8e8a1386f21Async(
+        std::function<void(std::int32_t)> response,
+        std::function<void(std::exception_ptr)>,
+        const Ice::Current&) final
+    {
+        response(1);
+    }
+
+    void op2c13b049b24c46d3Async(
+        std::function<void(std::int32_t)> response,
+        std::function<void(std::exception_ptr)>,
+        const Ice::Current&) final
+    {
+        response(2);
+    }
+};
+
+class HashMatchI final : public Test::HashMatch
+{
+public:
+    void op5675b8e8a1386f21Async(
+        std::function<void(std::int32_t)> response,
+        std::function<void(std::exception_ptr)>,
+        const Ice::Current&) final
+    {
+        response(1);
+    }
+};
+
 #endif
@@ -42,4 +42,17 @@ public:
     void throwAfterException(const Ice::Current&) override;
 };
 
+class HashCollisionI final : public Test::HashCollision
+{
+public:
+    std::int32_t op5675b8e8a1386f21(const Ice::Current&) final { return 1; }
+    std::int32_t op2c13b049b24c46d3(const Ice::Current&) final { return 2; }
+};
+
+class HashMatchI final : public Test::HashMatch
+{
+public:
+    std::int32_t op5675b8e8a1386f21(const Ice::Current&) final { return 1; }
+};
+
 #endif
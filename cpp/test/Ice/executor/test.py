@@ -0,0 +1,15 @@
+# Copyright (c) ZeroC, Inc.
+
+from Util import ClientServerTestCase, CollocatedTestCase, TestSuite
+
+testcases = [
+    ClientServerTestCase(),
+    CollocatedTestCase(),
+    # The AMI callbacks queued to the client thread pool are spread over its shards.
+    ClientServerTestCase(
+        name="client/server with sharded client thread pool",
+        props={"Ice.ThreadPool.Client.Shards": 4},
+    ),
+]
+
+TestSuite(__file__, testcases)
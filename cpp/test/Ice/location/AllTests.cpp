@@ -538,6 +538,90 @@ allTests(Test::TestHelper* helper, const string& ref)
     }
     cout << "ok" << endl;
 
+    cout << "testing locator cache for not registered adapters and objects... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCache.NotRegisteredTimeout", "1");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        count = locator->getRequestCount();
+        for (int j = 0; j < 2; ++j)
+        {
+            try
+            {
+                ic->stringToProxy("test@TestAdapterUnknown")->ice_ping();
+                test(false);
+            }
+            catch (const Ice::NotRegisteredException& ex)
+            {
+                test(ex.kindOfObject() == "object adapter");
+                test(ex.id() == "TestAdapterUnknown");
+            }
+
+            try
+            {
+                ic->stringToProxy("unknown/unknown")->ice_ping();
+                test(false);
+            }
+            catch (const Ice::NotRegisteredException& ex)
+            {
+                test(ex.kindOfObject() == "object");
+                test(ex.id() == "unknown/unknown");
+            }
+        }
+        count += 2; // The retries and the second lookups are answered by the locator cache.
+        test(count == locator->getRequestCount());
+
+        try
+        {
+            ic->stringToProxy("test@TestAdapterUnknown")->ice_locatorCacheTimeout(0)->ice_ping(); // No locator cache.
+            test(false);
+        }
+        catch (const Ice::NotRegisteredException&)
+        {
+        }
+        count += 2; // The invocation is retried once.
+        test(count == locator->getRequestCount());
+
+        this_thread::sleep_for(chrono::milliseconds(1200));
+        try
+        {
+            ic->stringToProxy("test@TestAdapterUnknown")->ice_ping();
+            test(false);
+        }
+        catch (const Ice::NotRegisteredException&)
+        {
+        }
+        test(++count == locator->getRequestCount());
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing locator cache maximum size... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCache.MaxSize", "1");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        registry->setAdapterDirectProxy("TestAdapter6", locator->findAdapterById("TestAdapter"));
+
+        count = locator->getRequestCount();
+        ic->stringToProxy("test@TestAdapter")->ice_ping();
+        ic->stringToProxy("test@TestAdapter")->ice_ping();
+        test(++count == locator->getRequestCount());
+        ic->stringToProxy("test@TestAdapter6")->ice_ping(); // Evicts TestAdapter from the cache.
+        ic->stringToProxy("test@TestAdapter6")->ice_ping();
+        test(++count == locator->getRequestCount());
+        ic->stringToProxy("test@TestAdapter")->ice_ping();
+        test(++count == locator->getRequestCount());
+
+        registry->setAdapterDirectProxy("TestAdapter6", nullopt);
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing proxy from server after shutdown... " << flush;
     hello = obj->getReplicatedHello();
     obj->shutdown();
@@ -784,6 +784,71 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         testAttribute(clientMetrics, clientProps, update.get(), "EndpointLookup", "endpointPort", port, c);
 
         cout << "ok" << endl;
+
+        cout << "testing endpoint lookup cache... " << flush;
+        {
+            // The cache holds a single entry: a lookup of another host and port evicts the cached addresses of
+            // localhost.
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.HostResolver.CacheTimeout", "3600");
+            initData.properties->setProperty("Ice.HostResolver.CacheMaxSize", "1");
+            initData.properties->setProperty("Ice.HostResolver.Size", "2");
+            initData.properties->setProperty("IceMX.Metrics.View.Map.EndpointLookup.GroupBy", "id");
+            initData.properties->setProperty("IceMX.Metrics.View.Map.Thread.GroupBy", "id");
+            // Don't filter out the lookup of the second port.
+            initData.properties->setProperty("IceMX.Metrics.View.Map.EndpointLookup.Accept.endpointPort", "");
+            Ice::CommunicatorPtr ic = Ice::initialize(initData);
+            auto icMetrics = Ice::uncheckedCast<IceMX::MetricsAdminPrx>(ic->getAdmin()->ice_facet("Metrics"));
+            string id = protocol + " -h localhost -p " + port + " -t 500";
+
+            // Only the first connection establishment looks up localhost, the other ones use the cached addresses.
+            Ice::ObjectPrx icPrx(ic, "metrics:" + protocol + " -h localhost -t 500 -p " + port);
+            for (int i = 0; i < 3; ++i)
+            {
+                icPrx->ice_ping();
+                icPrx->ice_getConnection()->close().get();
+            }
+
+            view = icMetrics->getMetricsView("View", timestamp);
+            test(view["EndpointLookup"].size() == 1);
+            m1 = view["EndpointLookup"][0];
+            test(m1->id == id && m1->total == 1);
+
+            // Look up localhost with another port, which evicts the cached addresses of the first endpoint. The next
+            // connection establishment of the first endpoint looks up localhost again.
+            try
+            {
+                Ice::ObjectPrx(ic, "metrics:" + protocol + " -h localhost -t 500 -p 1")->ice_ping();
+            }
+            catch (const Ice::LocalException&)
+            {
+            }
+            icPrx->ice_ping();
+            icPrx->ice_getConnection()->close().get();
+
+            view = icMetrics->getMetricsView("View", timestamp);
+            test(view["EndpointLookup"].size() == 2);
+            for (const auto& lookup : view["EndpointLookup"])
+            {
+                test(lookup->total == (lookup->id == id ? 2 : 1));
+            }
+
+            // Each resolver thread has its own observer.
+            int resolverThreads = 0;
+            for (const auto& thread : view["Thread"])
+            {
+                if (thread->id.find("Ice.HostResolver") == 0)
+                {
+                    test(thread->id == "Ice.HostResolver-0" || thread->id == "Ice.HostResolver-1");
+                    test(thread->current == 1 && thread->total == 1);
+                    ++resolverThreads;
+                }
+            }
+            test(resolverThreads == 2);
+            ic->destroy();
+        }
+        cout << "ok" << endl;
 #endif
     }
 
@@ -16,6 +16,58 @@ public:
 
 namespace
 {
+    class PassThroughMiddleware final : public Ice::Object
+    {
+    public:
+        PassThroughMiddleware(Ice::ObjectPtr next) : _next(std::move(next)) {}
+
+        void dispatch(Ice::IncomingRequest& request, std::function<void(Ice::OutgoingResponse)> sendResponse) final
+        {
+            _next->dispatch(request, std::move(sendResponse));
+        }
+
+    private:
+        Ice::ObjectPtr _next;
+    };
+
+    // The servant of an operation with the "cpp:direct-collocation" metadata receives the class instances of the
+    // caller when it's called directly, and copies of these instances when the invocation is marshaled.
+    void testDirectCollocation(const Ice::CommunicatorPtr& communicator, const Ice::ObjectPrx& prx)
+    {
+        cout << "testing direct collocated invocations... " << flush;
+
+        auto c = make_shared<Test::MyClass1>();
+        c->tesT = "direct";
+
+        // The object adapter uses the logger middleware installed by Ice.Warn.Dispatch (enabled by default), which
+        // doesn't prevent direct calls.
+        auto derived = Ice::uncheckedCast<Test::MyDerivedClassPrx>(prx);
+        derived->ice_ping(); // The first invocation caches the collocated request handler.
+        test(derived->opMyClass1(c) == c);
+
+        Ice::Context ctx{{"one", "ONE"}};
+        test(derived->opContext(ctx) == ctx);
+        test(derived->ice_context(ctx)->opContext() == ctx);
+
+        // An invocation with an invocation timeout is dispatched by a thread of the object adapter.
+        auto timeoutPrx = derived->ice_invocationTimeout(10s);
+        timeoutPrx->ice_ping();
+        Test::MyClass1Ptr r = timeoutPrx->opMyClass1(c);
+        test(r != c && r->tesT == "direct");
+
+        // The dispatch pipeline of an object adapter with other middleware is never bypassed.
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+        adapter->use([](Ice::ObjectPtr next) { return make_shared<PassThroughMiddleware>(std::move(next)); });
+        adapter->add(std::make_shared<MyDerivedClassI>(), Ice::stringToIdentity("middleware"));
+        Test::MyDerivedClassPrx middlewarePrx(communicator, "middleware");
+        middlewarePrx->ice_ping();
+        r = middlewarePrx->opMyClass1(c);
+        test(r != c && r->tesT == "direct");
+        adapter->destroy();
+
+        cout << "ok" << endl;
+    }
+
     void testCollocatedIPv6Invocation(Test::TestHelper* helper)
     {
         int port = helper->getTestPort(1);
@@ -57,6 +109,8 @@ Collocated::run(int argc, char** argv)
     Test::MyClassPrx allTests(Test::TestHelper*);
     allTests(this);
 
+    testDirectCollocation(communicator.communicator(), prx);
+
     testCollocatedIPv6Invocation(this);
 }
 
@@ -0,0 +1,37 @@
+# Copyright (c) ZeroC, Inc.
+
+from Util import (
+    ClientAMDServerTestCase,
+    ClientServerTestCase,
+    CollocatedTestCase,
+    Linux,
+    TestSuite,
+    platform,
+)
+
+testcases = [
+    ClientServerTestCase(),
+    ClientAMDServerTestCase(),
+    CollocatedTestCase(),
+    ClientServerTestCase(
+        name="client/server with sharded thread pools",
+        props={
+            "Ice.ThreadPool.Client.Shards": 2,
+            "Ice.ThreadPool.Server.Shards": 4,
+        },
+    ),
+]
+
+# On Linux, also run the client and server with the io_uring selector.
+if isinstance(platform, Linux):
+    testcases.append(
+        ClientServerTestCase(
+            name="client/server with io_uring",
+            props={
+                "Ice.ThreadPool.Client.IoUring": 1,
+                "Ice.ThreadPool.Server.IoUring": 1,
+            },
+        )
+    )
+
+TestSuite(__file__, testcases)
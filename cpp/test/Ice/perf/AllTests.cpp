@@ -0,0 +1,332 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+using namespace Ice;
+using namespace Test;
+
+//
+// This test measures the performance of the Ice runtime: twoway latency, oneway and batch oneway throughput, byte
+// sequence throughput, the marshaling speed of InputStream/OutputStream and the execute throughput of the client
+// thread pool. The number of iterations is set with Perf.Iterations (the default is small to keep the test suite
+// fast). If Perf.Output is set, the results are appended to this file as a JSON object on a single line, to track
+// regressions between releases. For example:
+//
+// python3 allTests.py --filter=Ice/perf --protocol=ssl --cprops="Perf.Iterations=100000 Perf.Output=/tmp/perf.jsonl"
+//
+
+namespace
+{
+    using Clock = chrono::steady_clock;
+
+    class Report
+    {
+    public:
+        Report(string transport, bool collocated, int iterations)
+            : _transport(std::move(transport)),
+              _collocated(collocated),
+              _iterations(iterations)
+        {
+        }
+
+        void add(string benchmark, vector<pair<string, double>> values)
+        {
+            _results.emplace_back(std::move(benchmark), std::move(values));
+        }
+
+        void write(ostream& os) const
+        {
+            os << "{\"ice\": \"" << ICE_STRING_VERSION << "\", \"transport\": \"" << _transport
+               << "\", \"collocated\": " << (_collocated ? "true" : "false") << ", \"iterations\": " << _iterations
+               << ", \"results\": {";
+            for (auto p = _results.begin(); p != _results.end(); ++p)
+            {
+                os << (p == _results.begin() ? "" : ", ") << "\"" << p->first << "\": {";
+                for (auto q = p->second.begin(); q != p->second.end(); ++q)
+                {
+                    os << (q == p->second.begin() ? "" : ", ") << "\"" << q->first << "\": " << fixed
+                       << setprecision(3) << q->second;
+                }
+                os << "}";
+            }
+            os << "}}" << endl;
+        }
+
+    private:
+        const string _transport;
+        const bool _collocated;
+        const int _iterations;
+        vector<pair<string, vector<pair<string, double>>>> _results;
+    };
+
+    double seconds(Clock::duration d) { return chrono::duration<double>(d).count(); }
+
+    double microseconds(Clock::duration d) { return chrono::duration<double, micro>(d).count(); }
+
+    // Returns the p-th percentile of the sorted samples, in microseconds.
+    double percentile(const vector<Clock::duration>& samples, double p)
+    {
+        auto index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+        return microseconds(samples[index]);
+    }
+
+    template<typename T> void marshalingSpeed(const CommunicatorPtr& communicator, const T& seq, int iterations,
+                                              const string& name, Report& report)
+    {
+        vector<byte> bytes;
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            OutputStream out(communicator);
+            out.write(seq);
+            out.finished(bytes);
+        }
+        auto marshal = Clock::now() - start;
+
+        T result;
+        start = Clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            InputStream in(communicator, bytes);
+            in.read(result);
+        }
+        auto unmarshal = Clock::now() - start;
+        test(result == seq);
+
+        double megabytes = static_cast<double>(bytes.size()) * iterations / (1024.0 * 1024.0);
+        report.add(
+            name,
+            {{"bytes", static_cast<double>(bytes.size())},
+             {"marshalMBps", megabytes / seconds(marshal)},
+             {"unmarshalMBps", megabytes / seconds(unmarshal)}});
+    }
+}
+
+PerfPrx
+allTests(TestHelper* helper, bool collocated)
+{
+    CommunicatorPtr communicator = helper->communicator();
+    PropertiesPtr properties = communicator->getProperties();
+    const int iterations = max(properties->getPropertyAsIntWithDefault("Perf.Iterations", 1000), 100);
+    string transport = collocated ? "collocated" : properties->getIceProperty("Ice.Default.Protocol");
+    Report report(transport, collocated, iterations);
+
+    PerfPrx perf(communicator, "perf:" + helper->getTestEndpoint());
+
+    {
+        cout << "measuring marshaling speed... " << flush;
+
+        FixedSeq fixedSeq(1000);
+        for (size_t i = 0; i < fixedSeq.size(); ++i)
+        {
+            fixedSeq[i] = {static_cast<int32_t>(i), static_cast<int64_t>(i) << 32, static_cast<double>(i) / 3};
+        }
+        marshalingSpeed(communicator, fixedSeq, iterations, "marshal.fixed", report);
+
+        VariableSeq variableSeq(100);
+        for (size_t i = 0; i < variableSeq.size(); ++i)
+        {
+            variableSeq[i].s = "variable length string #" + to_string(i);
+            variableSeq[i].seq.assign(i % 16, static_cast<int32_t>(i));
+        }
+        marshalingSpeed(communicator, variableSeq, iterations, "marshal.variable", report);
+
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "measuring twoway latency... " << flush;
+
+        // Warm up, this also establishes the connection.
+        for (int i = 0; i < iterations / 10; ++i)
+        {
+            perf->ping();
+        }
+
+        vector<Clock::duration> samples;
+        samples.reserve(static_cast<size_t>(iterations));
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            auto t = Clock::now();
+            perf->ping();
+            samples.push_back(Clock::now() - t);
+        }
+        auto total = Clock::now() - start;
+        sort(samples.begin(), samples.end());
+
+        report.add(
+            "twoway.latency",
+            {{"meanUs", microseconds(total) / iterations},
+             {"p50Us", percentile(samples, 0.5)},
+             {"p90Us", percentile(samples, 0.9)},
+             {"p99Us", percentile(samples, 0.99)},
+             {"p999Us", percentile(samples, 0.999)},
+             {"maxUs", microseconds(samples.back())}});
+
+        cout << "ok (p50 = " << fixed << setprecision(1) << percentile(samples, 0.5)
+             << "us, p99 = " << percentile(samples, 0.99) << "us)" << endl;
+    }
+
+    {
+        cout << "measuring oneway throughput... " << flush;
+        PerfPrx oneway = perf->ice_oneway();
+        const int count = iterations * 10;
+        auto start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            oneway->ping();
+        }
+        perf->ping(); // Wait for the oneway requests to be dispatched.
+        auto total = Clock::now() - start;
+        report.add("oneway.throughput", {{"requestsPerSecond", count / seconds(total)}});
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "measuring batch oneway throughput... " << flush;
+        PerfPrx batch = perf->ice_batchOneway();
+        const int count = iterations * 10;
+        auto start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            batch->ping();
+            if (i % 1000 == 999)
+            {
+                batch->ice_flushBatchRequests();
+            }
+        }
+        batch->ice_flushBatchRequests();
+        perf->ping(); // Wait for the batch requests to be dispatched.
+        auto total = Clock::now() - start;
+        report.add("batch.throughput", {{"requestsPerSecond", count / seconds(total)}});
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "measuring byte sequence throughput... " << flush;
+        const int32_t size = 1024 * 1024;
+        const int count = max(iterations / 100, 10);
+        ByteSeq bytes(static_cast<size_t>(size));
+
+        auto start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            perf->sendBytes(bytes);
+        }
+        auto send = Clock::now() - start;
+
+        start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            test(perf->recvBytes(size).size() == bytes.size());
+        }
+        auto recv = Clock::now() - start;
+
+        report.add(
+            "bytes.throughput",
+            {{"bytes", static_cast<double>(size)},
+             {"sendMBps", count / seconds(send)},
+             {"recvMBps", count / seconds(recv)}});
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "measuring struct sequence throughput... " << flush;
+        FixedSeq fixedSeq(10000);
+        VariableSeq variableSeq(1000, {"variable length string", IntSeq(8)});
+        const int count = max(iterations / 10, 10);
+
+        auto start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            perf->sendFixed(fixedSeq);
+        }
+        auto fixedTime = Clock::now() - start;
+
+        start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            perf->sendVariable(variableSeq);
+        }
+        auto variableTime = Clock::now() - start;
+
+        report.add(
+            "structs.throughput",
+            {{"fixedPerSecond", count / seconds(fixedTime)}, {"variablePerSecond", count / seconds(variableTime)}});
+        cout << "ok" << endl;
+    }
+
+    {
+        const int producers = 8;
+        cout << "measuring thread pool execute throughput with " << producers << " producer threads... " << flush;
+
+        InitializationData initData;
+        initData.properties = properties->clone();
+        initData.properties->setProperty("Ice.ThreadPool.Client.Size", "4");
+        CommunicatorHolder ich = initialize(initData);
+
+        const int callsPerProducer = iterations * 10;
+        const int calls = producers * callsPerProducer;
+        atomic<int> executed{0};
+        promise<void> done;
+
+        auto start = Clock::now();
+        vector<thread> threads;
+        for (int i = 0; i < producers; ++i)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    for (int j = 0; j < callsPerProducer; ++j)
+                    {
+                        ich->postToClientThreadPool(
+                            [&]
+                            {
+                                if (++executed == calls)
+                                {
+                                    done.set_value();
+                                }
+                            });
+                    }
+                });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        done.get_future().wait();
+        auto elapsed = Clock::now() - start;
+
+        test(executed == calls);
+        report.add("execute.throughput", {{"producers", producers}, {"callsPerSecond", calls / seconds(elapsed)}});
+        cout << "ok" << endl;
+    }
+
+    string output = properties->getProperty("Perf.Output");
+    if (!output.empty())
+    {
+        ofstream os(output, ios::app);
+        test(os.good());
+        report.write(os);
+    }
+    else
+    {
+        ostringstream os;
+        report.write(os);
+        cout << os.str() << flush;
+    }
+    return perf;
+}
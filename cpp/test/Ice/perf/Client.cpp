@@ -0,0 +1,28 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+using namespace std;
+
+class Client : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    properties->setProperty("Ice.MessageSizeMax", "10240"); // 10MB
+
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+
+    Test::PerfPrx allTests(Test::TestHelper*, bool);
+    Test::PerfPrx perf = allTests(this, false);
+    perf->shutdown();
+}
+
+DEFINE_TEST(Client)
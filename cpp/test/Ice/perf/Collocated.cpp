@@ -0,0 +1,31 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+#include "TestI.h"
+
+using namespace std;
+
+class Collocated : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+};
+
+void
+Collocated::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    properties->setProperty("Ice.MessageSizeMax", "10240"); // 10MB
+
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(make_shared<PerfI>(), Ice::stringToIdentity("perf"));
+    // Don't activate OA to ensure collocation is used.
+
+    Test::PerfPrx allTests(Test::TestHelper*, bool);
+    allTests(this, true);
+}
+
+DEFINE_TEST(Collocated)
@@ -0,0 +1,38 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TestI.h"
+#include "Ice/Ice.h"
+
+using namespace std;
+
+void
+PerfI::ping(const Ice::Current&)
+{
+}
+
+void
+PerfI::sendBytes(Ice::ByteSeq, const Ice::Current&)
+{
+}
+
+Ice::ByteSeq
+PerfI::recvBytes(int32_t size, const Ice::Current&)
+{
+    return Ice::ByteSeq(static_cast<size_t>(size));
+}
+
+void
+PerfI::sendFixed(Test::FixedSeq, const Ice::Current&)
+{
+}
+
+void
+PerfI::sendVariable(Test::VariableSeq, const Ice::Current&)
+{
+}
+
+void
+PerfI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,22 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+class PerfI final : public Test::Perf
+{
+public:
+    void ping(const Ice::Current&) final;
+
+    void sendBytes(Ice::ByteSeq, const Ice::Current&) final;
+    Ice::ByteSeq recvBytes(std::int32_t, const Ice::Current&) final;
+
+    void sendFixed(Test::FixedSeq, const Ice::Current&) final;
+    void sendVariable(Test::VariableSeq, const Ice::Current&) final;
+
+    void shutdown(const Ice::Current&) final;
+};
+
+#endif
@@ -610,6 +610,64 @@ allTests(Test::TestHelper* helper)
         in2.read(arr2S);
     }
 
+    {
+        FixedStructS arr;
+        for (int i = 0; i < 4; ++i)
+        {
+            arr.push_back(FixedStruct{
+                i * 10000000000LL,
+                i + 0.5,
+                -i,
+                static_cast<float>(i) / 4,
+                static_cast<int16_t>(i * 2),
+                static_cast<uint8_t>(i),
+                static_cast<uint8_t>(255 - i),
+                i * 3});
+        }
+
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        static_assert(Ice::IsBulkCopyable<FixedStruct>::value);
+#endif
+        static_assert(!Ice::IsBulkCopyable<PaddedFixedStruct>::value);
+        static_assert(!Ice::IsBulkCopyable<LargeStruct>::value);
+
+        // The fields are marshaled in order, without padding.
+        Ice::OutputStream expected(communicator);
+        expected.writeSize(static_cast<int32_t>(arr.size()));
+        for (const auto& s : arr)
+        {
+            expected.writeAll(s.l, s.d, s.i, s.f, s.sh, s.by1, s.by2, s.i2);
+        }
+
+        Ice::OutputStream out(communicator);
+        out.write(arr);
+        test(out.b.size() == 1 + arr.size() * 32);
+        test(equal(out.b.begin(), out.b.end(), expected.b.begin(), expected.b.end()));
+        out.finished(data);
+        Ice::InputStream in(communicator, data);
+        FixedStructS arr2;
+        in.read(arr2);
+        test(arr2 == arr);
+
+        Ice::OutputStream out2(communicator);
+        out2.write(arr[3]);
+        out2.finished(data);
+        Ice::InputStream in2(communicator, data);
+        FixedStruct s2;
+        in2.read(s2);
+        test(s2 == arr[3]);
+
+        PaddedFixedStructS arr3{PaddedFixedStruct{1, 2.5}, PaddedFixedStruct{3, 4.5}};
+        Ice::OutputStream out3(communicator);
+        out3.write(arr3);
+        test(out3.b.size() == 1 + arr3.size() * 9);
+        out3.finished(data);
+        Ice::InputStream in3(communicator, data);
+        PaddedFixedStructS arr4;
+        in3.read(arr4);
+        test(arr4 == arr3);
+    }
+
     {
         MyClassS arr;
         for (int i = 0; i < 4; ++i)
@@ -156,6 +156,35 @@ allTestsWithController(Test::TestHelper* helper, const ControllerPrx& controller
             test(false);
         }
     }
+    {
+        //
+        // Expect InvocationTimeoutException for requests that are queued or partially written when the invocation
+        // timeout is reached. The canceled requests must not corrupt the stream: the connection remains usable.
+        //
+        Ice::ConnectionPtr connection = timeout->ice_getConnection();
+        TimeoutPrx to = timeout->ice_invocationTimeout(500);
+        controller->holdAdapter(-1);
+        ByteSeq seq(30000);
+        vector<future<void>> results;
+        for (int i = 0; i < 20; ++i)
+        {
+            results.push_back(to->sendDataAsync(seq));
+        }
+        for (auto& f : results)
+        {
+            try
+            {
+                f.get();
+                test(false);
+            }
+            catch (const Ice::InvocationTimeoutException&)
+            {
+            }
+        }
+        controller->resumeAdapter();
+        timeout->op();
+        test(connection == timeout->ice_getConnection());
+    }
     cout << "ok" << endl;
 
     cout << "testing close timeout... " << flush;
@@ -0,0 +1,78 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+
+#include <future>
+#include <vector>
+
+using namespace std;
+
+class Client : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    {
+        cout << "testing work items ordering... " << flush;
+        Ice::CommunicatorHolder ich = initialize(argc, argv);
+
+        // Block the single client thread pool thread and queue more items than the lock-free queue can hold.
+        promise<void> blocked;
+        promise<void> release;
+        ich->postToClientThreadPool(
+            [&]
+            {
+                blocked.set_value();
+                release.get_future().wait();
+            });
+        blocked.get_future().wait();
+
+        const int count = 5000;
+        vector<int> order;
+        order.reserve(count);
+        promise<void> done;
+        for (int i = 0; i < count; ++i)
+        {
+            ich->postToClientThreadPool(
+                [&order, &done, i]
+                {
+                    order.push_back(i);
+                    if (i == count - 1)
+                    {
+                        done.set_value();
+                    }
+                });
+        }
+        release.set_value();
+        done.get_future().wait();
+
+        test(order.size() == static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i)
+        {
+            test(order[i] == i);
+        }
+        cout << "ok" << endl;
+    }
+
+    {
+        cout << "testing execute after destroy... " << flush;
+        Ice::CommunicatorPtr communicator = initialize(argc, argv);
+        communicator->destroy();
+        try
+        {
+            communicator->postToClientThreadPool([] {});
+            test(false);
+        }
+        catch (const Ice::CommunicatorDestroyedException&)
+        {
+        }
+        cout << "ok" << endl;
+    }
+}
+
+DEFINE_TEST(Client)
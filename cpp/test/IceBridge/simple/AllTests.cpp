@@ -117,6 +117,31 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing user exceptions... " << flush;
+    {
+        try
+        {
+            cl->throwTestError("forwarded");
+            test(false);
+        }
+        catch (const Test::TestError& ex)
+        {
+            test(ex.reason == "forwarded");
+        }
+
+        try
+        {
+            cl->throwTestErrorAsync(string(10000, 'x')).get();
+            test(false);
+        }
+        catch (const Test::TestError& ex)
+        {
+            test(ex.reason == string(10000, 'x'));
+        }
+        cl->ice_ping();
+    }
+    cout << "ok" << endl;
+
     cout << "testing ordering... " << flush;
     {
         //
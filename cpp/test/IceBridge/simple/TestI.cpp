@@ -91,6 +91,13 @@ MyClassI::closeConnection(bool forceful, const Ice::Current& current)
     }
 }
 
+void
+MyClassI::throwTestError(string reason, const Ice::Current& current)
+{
+    checkConnection(current.con);
+    throw TestError{std::move(reason)};
+}
+
 void
 MyClassI::datagram(const Ice::Current& current)
 {
@@ -23,6 +23,8 @@ public:
     std::string getConnectionInfo(const Ice::Current&) override;
     void closeConnection(bool, const Ice::Current&) override;
 
+    void throwTestError(std::string, const Ice::Current&) override;
+
     void datagram(const Ice::Current&) override;
     int getDatagramCount(const Ice::Current&) override;
 
@@ -834,6 +834,58 @@ allTests(Test::TestHelper* helper)
     };
     cout << "ok" << endl;
 
+    cout << "testing least loaded node queries with object updates... " << flush;
+    {
+        //
+        // The objects of a server on the inactive node have the highest load. The object of the replica group has
+        // the load of its least loaded replica, the server on the local node.
+        //
+        const string type = "::Test::LeastLoaded";
+        test(!query->findObjectByTypeOnLeastLoadedNode(type, LoadSample::LoadSample1));
+
+        map<string, string> params;
+        params["replicaGroup"] = "Random";
+        params["id"] = "Server1";
+        instantiateServer(admin, "Server", "inactivenode", params);
+        params["id"] = "Server2";
+        instantiateServer(admin, "Server", "localnode", params);
+
+        admin->addObjectWithType(Ice::ObjectPrx(comm, "leastLoaded1@Server1.ReplicatedAdapter"), type);
+        test(
+            query->findObjectByTypeOnLeastLoadedNode(type, LoadSample::LoadSample1)->ice_getAdapterId() ==
+            "Server1.ReplicatedAdapter");
+
+        admin->addObjectWithType(Ice::ObjectPrx(comm, "leastLoaded2@Server2.ReplicatedAdapter"), type);
+        for (int i = 0; i < 10; ++i)
+        {
+            test(
+                query->findObjectByTypeOnLeastLoadedNode(type, LoadSample::LoadSample1)->ice_getAdapterId() ==
+                "Server2.ReplicatedAdapter");
+        }
+
+        admin->addObjectWithType(Ice::ObjectPrx(comm, "leastLoaded3@Random"), type);
+        set<string> adapterIds;
+        for (int i = 0; i < 50; ++i)
+        {
+            adapterIds.insert(
+                query->findObjectByTypeOnLeastLoadedNode(type, LoadSample::LoadSample1)->ice_getAdapterId());
+        }
+        test(adapterIds.find("Server1.ReplicatedAdapter") == adapterIds.end());
+
+        admin->removeObject(Ice::stringToIdentity("leastLoaded2"));
+        admin->removeObject(Ice::stringToIdentity("leastLoaded3"));
+        test(
+            query->findObjectByTypeOnLeastLoadedNode(type, LoadSample::LoadSample1)->ice_getAdapterId() ==
+            "Server1.ReplicatedAdapter");
+
+        admin->removeObject(Ice::stringToIdentity("leastLoaded1"));
+        test(!query->findObjectByTypeOnLeastLoadedNode(type, LoadSample::LoadSample1));
+
+        removeServer(admin, "Server1");
+        removeServer(admin, "Server2");
+    }
+    cout << "ok" << endl;
+
     cout << "testing replica group from different applications... " << flush;
     {
         map<string, string> params;
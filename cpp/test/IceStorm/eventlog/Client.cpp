@@ -0,0 +1,279 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "IceStorm/IceStorm.h"
+#include "TestHelper.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+using namespace Ice;
+using namespace IceStorm;
+using namespace Test;
+
+namespace
+{
+    // Records the offsets of the events it receives, from the IceStorm.Offset context entry.
+    class EventLogSubscriberI final : public Ice::Blobject
+    {
+    public:
+        bool ice_invoke(vector<byte>, vector<byte>& outParams, const Current& current) final
+        {
+            auto p = current.ctx.find("IceStorm.Offset");
+            test(p != current.ctx.end());
+            {
+                lock_guard lock(_mutex);
+                _offsets.push_back(stoll(p->second));
+            }
+            _condition.notify_all();
+
+            OutputStream out(current.adapter->getCommunicator());
+            out.startEncapsulation();
+            out.endEncapsulation();
+            out.finished(outParams);
+            return true;
+        }
+
+        // Waits for the event with the given offset and returns the offsets of the events received until then.
+        vector<int64_t> waitFor(int64_t offset)
+        {
+            unique_lock lock(_mutex);
+            while (_offsets.empty() || _offsets.back() < offset)
+            {
+                if (_condition.wait_for(lock, 30s) == cv_status::timeout)
+                {
+                    test(false);
+                }
+            }
+            test(_offsets.back() == offset);
+            return _offsets;
+        }
+
+    private:
+        vector<int64_t> _offsets;
+        mutex _mutex;
+        condition_variable _condition;
+    };
+    using EventLogSubscriberIPtr = shared_ptr<EventLogSubscriberI>;
+
+    void testOffsets(const vector<int64_t>& offsets, int64_t first, int64_t last)
+    {
+        test(static_cast<int64_t>(offsets.size()) == last - first + 1);
+        for (size_t i = 0; i < offsets.size(); ++i)
+        {
+            test(offsets[i] == first + static_cast<int64_t>(i));
+        }
+    }
+
+    void publish(const ObjectPrx& publisher, int count, size_t payloadSize = 0)
+    {
+        OutputStream out(publisher->ice_getCommunicator());
+        out.startEncapsulation();
+        if (payloadSize > 0)
+        {
+            out.write(vector<byte>(payloadSize));
+        }
+        out.endEncapsulation();
+        vector<byte> inParams;
+        out.finished(inParams);
+
+        for (int i = 0; i < count; ++i)
+        {
+            vector<byte> outParams;
+            test(publisher->ice_invoke("event", OperationMode::Normal, inParams, outParams));
+        }
+    }
+
+    QoS replayQoS(const string& name, const string& value)
+    {
+        QoS qos;
+        qos["reliability"] = "ordered";
+        qos[name] = value;
+        return qos;
+    }
+
+    TopicPrx createOrRetrieve(const TopicManagerPrx& manager, const string& name)
+    {
+        try
+        {
+            return *manager->create(name);
+        }
+        catch (const TopicExists&)
+        {
+            return *manager->retrieve(name);
+        }
+    }
+}
+
+class Client final : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+
+private:
+    EventLogSubscriberIPtr subscribe(const TopicPrx&, const QoS& = QoS{{"reliability", "ordered"}});
+
+    ObjectAdapterPtr _adapter;
+    vector<pair<TopicPrx, ObjectPrx>> _subscriptions;
+};
+
+EventLogSubscriberIPtr
+Client::subscribe(const TopicPrx& topic, const QoS& qos)
+{
+    auto servant = make_shared<EventLogSubscriberI>();
+    auto subscriber = _adapter->addWithUUID(servant);
+    topic->subscribeAndGetPublisher(qos, subscriber);
+    _subscriptions.emplace_back(topic, subscriber);
+    return servant;
+}
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::CommunicatorHolder ich = initialize(argc, argv, make_shared<Ice::Properties>(vector<string>{"IceStormAdmin"}));
+    const auto& communicator = ich.communicator();
+    auto managerProxy = communicator->getProperties()->getIceProperty("IceStormAdmin.TopicManager.Default");
+    if (managerProxy.empty())
+    {
+        ostringstream os;
+        os << argv[0] << ": property `IceStormAdmin.TopicManager.Default' is not set";
+        throw invalid_argument(os.str());
+    }
+
+    if (argc != 2)
+    {
+        throw invalid_argument("client create|check");
+    }
+
+    TopicManagerPrx manager(communicator, managerProxy);
+    _adapter = communicator->createObjectAdapterWithEndpoints("EventLogAdapter", "default");
+    _adapter->activate();
+
+    // The replay, retention and large topics are logged. The events of the replay topic have no parameters, so that
+    // the retention size doesn't remove them.
+    TopicPrx replay = createOrRetrieve(manager, "replay");
+    ObjectPrx replayPublisher = *replay->getPublisher();
+    TopicPrx large = createOrRetrieve(manager, "large");
+    ObjectPrx largePublisher = *large->getPublisher();
+
+    string action(argv[1]);
+    if (action == "create")
+    {
+        cout << "testing replay QoS validation... " << flush;
+        {
+            TopicPrx unlogged = createOrRetrieve(manager, "unlogged");
+            try
+            {
+                subscribe(unlogged, replayQoS("replayFromOffset", "0"));
+                test(false);
+            }
+            catch (const BadQoS&)
+            {
+            }
+
+            for (const auto& [name, value] : vector<pair<string, string>>{
+                     {"replayFromOffset", "abc"},
+                     {"replayFromOffset", "-1"},
+                     {"replayFromTime", "now"}})
+            {
+                try
+                {
+                    subscribe(replay, replayQoS(name, value));
+                    test(false);
+                }
+                catch (const BadQoS&)
+                {
+                }
+            }
+            test(replay->getSubscribers().empty());
+        }
+        cout << "ok" << endl;
+
+        cout << "testing replay... " << flush;
+        {
+            publish(replayPublisher, 150);
+
+            // More events than the send queue of the subscriber: all the events are replayed, in order.
+            auto s1 = subscribe(replay, replayQoS("replayFromOffset", "0"));
+            testOffsets(s1->waitFor(149), 0, 149);
+
+            // The events published after the subscription follow the replayed events.
+            publish(replayPublisher, 10);
+            testOffsets(s1->waitFor(159), 0, 159);
+
+            auto s2 = subscribe(replay, replayQoS("replayFromOffset", "155"));
+            testOffsets(s2->waitFor(159), 155, 159);
+
+            // No event is more recent than one hour from now.
+            auto inOneHour = chrono::system_clock::now() + 1h;
+            auto s3 = subscribe(
+                replay,
+                replayQoS(
+                    "replayFromTime",
+                    to_string(chrono::duration_cast<chrono::milliseconds>(inOneHour.time_since_epoch()).count())));
+            publish(replayPublisher, 1);
+            testOffsets(s3->waitFor(160), 160, 160);
+            testOffsets(s1->waitFor(160), 0, 160);
+
+            // Events published while a subscriber replays are neither lost nor received twice.
+            thread publisher([&replayPublisher] { publish(replayPublisher, 200); });
+            auto s4 = subscribe(replay, replayQoS("replayFromOffset", "0"));
+            publisher.join();
+            testOffsets(s4->waitFor(360), 0, 360);
+            testOffsets(s1->waitFor(360), 0, 360);
+        }
+        cout << "ok" << endl;
+
+        cout << "testing retention... " << flush;
+        {
+            // The events of the retention topic exceed the retention size, the oldest events are removed.
+            TopicPrx retention = createOrRetrieve(manager, "retention");
+            ObjectPrx retentionPublisher = *retention->getPublisher();
+            publish(retentionPublisher, 50, 2000);
+
+            auto s1 = subscribe(retention, replayQoS("replayFromOffset", "0"));
+            publish(retentionPublisher, 1);
+            vector<int64_t> offsets = s1->waitFor(50);
+            test(offsets.front() > 0 && offsets.size() < 50);
+            testOffsets(offsets, offsets.front(), 50);
+
+            // Each event of the large topic exceeds the retention size, so the retention removes all the events.
+            auto s2 = subscribe(large);
+            publish(largePublisher, 3, 30000);
+            testOffsets(s2->waitFor(2), 0, 2);
+
+            auto s3 = subscribe(large, replayQoS("replayFromOffset", "0"));
+            publish(largePublisher, 1, 30000);
+            testOffsets(s3->waitFor(3), 3, 3);
+            testOffsets(s2->waitFor(3), 0, 3);
+        }
+        cout << "ok" << endl;
+    }
+    else
+    {
+        cout << "testing restored event log... " << flush;
+        {
+            auto s1 = subscribe(replay, replayQoS("replayFromOffset", "355"));
+            testOffsets(s1->waitFor(360), 355, 360);
+            publish(replayPublisher, 1);
+            testOffsets(s1->waitFor(361), 355, 361);
+
+            // The offsets of the large topic don't restart at 0, even though the retention removed all its events.
+            auto s2 = subscribe(large);
+            publish(largePublisher, 1, 30000);
+            testOffsets(s2->waitFor(4), 4, 4);
+        }
+        cout << "ok" << endl;
+    }
+
+    for (const auto& [topic, subscriber] : _subscriptions)
+    {
+        topic->unsubscribe(subscriber);
+    }
+}
+
+DEFINE_TEST(Client)
@@ -0,0 +1,56 @@
+# Copyright (c) ZeroC, Inc.
+
+from IceStormUtil import IceStorm, IceStormProcess, IceStormTestCase
+from Util import Client, ClientTestCase, TestSuite
+
+#
+# The second IceStorm service restarts with the database of the first one, to check that the event logs and their
+# offsets are restored. The send queue of the subscribers is smaller than the replayed event logs, which are queued as
+# the subscribers send them.
+#
+props = {
+    "IceStorm.EventLog.Topics": "replay retention large",
+    "IceStorm.EventLog.RetentionSize": 20000,
+    "IceStorm.Send.QueueSizeMax": 100,
+}
+icestorm1 = IceStorm(createDb=True, cleanDb=False, props=props)
+icestorm2 = IceStorm(createDb=False, cleanDb=True, props=props)
+
+
+class IceStormEventLogTestCase(IceStormTestCase):
+    def teardownClientSide(self, current, success):
+        self.shutdown(current)
+
+
+class EventLogClient(IceStormProcess, Client):
+    processType = "client"
+
+    def __init__(self, instanceName=None, instance=None, *args, **kargs):
+        Client.__init__(self, *args, **kargs)
+        IceStormProcess.__init__(self, instanceName, instance)
+
+    getParentProps = (
+        Client.getProps
+    )  # Used by IceStormProcess to get the client properties
+
+
+TestSuite(
+    __file__,
+    [
+        IceStormEventLogTestCase(
+            "event log create",
+            icestorm1,
+            client=ClientTestCase(
+                client=EventLogClient(instance=icestorm1, args=["create"])
+            ),
+        ),
+        IceStormEventLogTestCase(
+            "event log check",
+            icestorm2,
+            client=ClientTestCase(
+                client=EventLogClient(instance=icestorm2, args=["check"])
+            ),
+        ),
+    ],
+    multihost=False,
+)
@@ -16,7 +16,7 @@ using namespace Test;
 class SingleI final : public Single
 {
 public:
-    SingleI(string name) : _name(std::move(name)) {}
+    SingleI(string name, bool trace = true) : _name(std::move(name)), _trace(trace) {}
 
     void event(int i, const Current& current) override
     {
@@ -27,11 +27,11 @@ public:
             cerr << endl << "expected oneway request";
             test(false);
         }
-        else if ((_name == "twoway" || _name == "twoway ordered") && current.requestId == 0)
+        else if (_name.find("twoway") == 0 && current.requestId == 0)
         {
             cerr << endl << "expected twoway request";
         }
-        if (_name == "twoway ordered" && i != _last)
+        if (_name.find("twoway ordered") == 0 && i != _last)
         {
             cerr << endl << "received unordered event for `" << _name << "': " << i << " " << _last;
             test(false);
@@ -56,7 +56,10 @@ public:
     void waitForEvents()
     {
         unique_lock<mutex> lock(_mutex);
-        cout << "testing " << _name << " ... " << flush;
+        if (_trace)
+        {
+            cout << "testing " << _name << " ... " << flush;
+        }
         bool datagram = _name == "datagram" || _name == "batch datagram";
         while (_count < 1000)
         {
@@ -84,11 +87,15 @@ public:
         {
             test(_connections.size() == 2);
         }
-        cout << "ok" << endl;
+        if (_trace)
+        {
+            cout << "ok" << endl;
+        }
     }
 
 private:
     const string _name;
+    const bool _trace;
     int _count{0};
     int _last{0};
     set<shared_ptr<Ice::Connection>> _connections;
@@ -200,6 +207,42 @@ Subscriber::run(int argc, char** argv)
         topic->subscribeAndGetPublisher(qos, object);
     }
 
+    {
+        // The pipelined events are received in order over a single connection, use a separate adapter that dispatches
+        // the requests of a connection one at a time to dispatch them in order.
+        communicator->getProperties()->setProperty("OrderedWindowAdapter.ThreadPool.Size", "4");
+        communicator->getProperties()->setProperty("OrderedWindowAdapter.ThreadPool.Serialize", "1");
+        auto adpt = communicator->createObjectAdapterWithEndpoints("OrderedWindowAdapter", "default");
+        subscribers.push_back(make_shared<SingleI>("twoway ordered window")); // Ordered, pipelined
+        IceStorm::QoS qos;
+        qos["reliability"] = "ordered";
+        qos["window"] = "100";
+        auto object = adpt->addWithUUID(subscribers.back());
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        adpt->activate();
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        subscribers.push_back(make_shared<SingleI>("twoway window")); // Pipelined
+        IceStorm::QoS qos;
+        qos["window"] = "100";
+        auto object = adapter->addWithUUID(subscribers.back());
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        IceStorm::QoS qos;
+        qos["window"] = "0";
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(make_shared<SingleI>("invalid window")));
+            test(false);
+        }
+        catch (const IceStorm::BadQoS&)
+        {
+        }
+    }
+
     {
         subscribers.push_back(make_shared<SingleI>("per-request load balancing"));
         IceStorm::QoS qos;
@@ -234,6 +277,19 @@ Subscriber::run(int argc, char** argv)
         topic->subscribeAndGetPublisher(IceStorm::QoS(), object);
     }
 
+    // Enough ordered subscribers for the topic to queue the events with its send threads, when IceStorm.Send.Threads
+    // is set. Each of them checks that it receives the events in order.
+    vector<shared_ptr<SingleI>> fanOutSubscribers;
+    for (int i = 0; i < 64; ++i)
+    {
+        fanOutSubscribers.push_back(make_shared<SingleI>("twoway ordered fan-out", false));
+        IceStorm::QoS qos;
+        qos["reliability"] = "ordered";
+        auto object = adapter->addWithUUID(fanOutSubscribers.back());
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+
     adapter->activate();
 
     vector<Ice::Identity> ids = topic->getSubscribers();
@@ -247,6 +303,13 @@ Subscriber::run(int argc, char** argv)
     {
         p->waitForEvents();
     }
+
+    cout << "testing " << fanOutSubscribers.size() << " twoway ordered subscribers ... " << flush;
+    for (const auto& p : fanOutSubscribers)
+    {
+        p->waitForEvents();
+    }
+    cout << "ok" << endl;
 }
 
 DEFINE_TEST(Subscriber)
@@ -16,10 +16,15 @@ persistent = IceStorm(props=props)
 transient = IceStorm(props=props, transient=True)
 replicated = [IceStorm(replica=i, nreplicas=3, props=props) for i in range(0, 3)]
 
+# Queue the events to the subscribers with send threads.
+sendThreadsProps = dict(props, **{"IceStorm.Send.Threads": 2})
+persistentSendThreads = IceStorm(props=sendThreadsProps)
+transientSendThreads = IceStorm(props=sendThreadsProps, transient=True)
+
 sub = Subscriber(
     args=["{testcase.parent.name}"],
     props={"Ice.UDP.RcvSize": 1024 * 1024},
-    readyCount=3,
+    readyCount=4,
 )
 pub = Publisher(args=["{testcase.parent.name}"])
 
@@ -51,6 +56,16 @@ TestSuite(
             icestorm=replicated,
             client=ClientServerTestCase(client=pub, server=sub),
         ),
+        IceStormSingleTestCase(
+            "persistent with send threads",
+            icestorm=persistentSendThreads,
+            client=ClientServerTestCase(client=pub, server=sub),
+        ),
+        IceStormSingleTestCase(
+            "transient with send threads",
+            icestorm=transientSendThreads,
+            client=ClientServerTestCase(client=pub, server=sub),
+        ),
     ],
     multihost=False,
 )
@@ -221,6 +221,55 @@ Client::run(int, char*[])
             test(count == task->getCount() || count + 1 == task->getCount());
         }
 
+        {
+            // Tasks scheduled in different levels of the timing wheel, including beyond its range.
+            vector<TestTaskPtr> tasks;
+            vector<chrono::milliseconds> delays{
+                chrono::hours(24 * 365),
+                chrono::hours(10),
+                chrono::minutes(30),
+                chrono::seconds(10),
+                chrono::milliseconds(300),
+                chrono::milliseconds(100),
+                chrono::milliseconds(20)};
+            for (const auto& delay : delays)
+            {
+                tasks.push_back(make_shared<TestTask>(delay));
+                timer->schedule(tasks.back(), delay);
+            }
+
+            for (size_t i = 0; i < tasks.size(); ++i)
+            {
+                test(timer->isScheduled(tasks[i]));
+                if (i < 4)
+                {
+                    test(timer->cancel(tasks[i]));
+                    test(!timer->isScheduled(tasks[i]));
+                }
+            }
+
+            for (size_t i = 4; i < tasks.size(); ++i)
+            {
+                tasks[i]->waitForRun();
+                test(!timer->isScheduled(tasks[i]));
+            }
+            test(tasks[6]->getRunTime() <= tasks[5]->getRunTime());
+            test(tasks[5]->getRunTime() <= tasks[4]->getRunTime());
+            for (size_t i = 0; i < 4; ++i)
+            {
+                test(!tasks[i]->hasRun());
+            }
+        }
+
+        {
+            IceInternal::Timer::Statistics statistics = timer->getStatistics();
+            test(statistics.scheduledTasks == 0);
+            test(statistics.maxScheduledTasks >= 20);
+            test(statistics.runTasks >= 27);
+            test(statistics.maxLateness >= chrono::nanoseconds::zero());
+            test(statistics.totalLateness >= statistics.maxLateness);
+        }
+
         timer->destroy();
     }
     cout << "ok" << endl;
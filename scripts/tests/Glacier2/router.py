@@ -13,7 +13,12 @@ passwords = {
     "userid-4": "abc123",
 }
 
+#
+# The router and the server dispatch the requests of a connection in order, for the test of the order of oneway
+# requests to several targets.
+#
 routerProps = {
+    "Ice.ThreadPool.Server.Serialize": 1,
     "Ice.Warn.Dispatch": "0",
     "Ice.Warn.Connections": "0",
     "Glacier2.Filter.Category.Accept": "c1 c2",
@@ -21,6 +26,10 @@ routerProps = {
     "Glacier2.Client.Connection.IdleTimeout": "30",
 }
 
+serverProps = {
+    "Ice.ThreadPool.Server.Serialize": 1,
+}
+
 traceProps = {
     "Ice.Trace.Protocol": 1,
     "Ice.Trace.Network": 2,
@@ -35,7 +44,16 @@ Glacier2TestSuite(
             name="client/server with router",
             servers=[
                 Glacier2Router(passwords=passwords),
-                Server(),
+                Server(props=serverProps),
+            ],
+            clients=[Client(), Client(args=["--shutdown"])],
+            traceProps=traceProps,
+        ),
+        ClientServerTestCase(
+            name="client/server with router and batching",
+            servers=[
+                Glacier2Router(passwords=passwords, props={"Glacier2.Client.Batch.FlushInterval": 10}),
+                Server(props=serverProps),
             ],
             clients=[Client(), Client(args=["--shutdown"])],
             traceProps=traceProps,
@@ -1,23 +1,49 @@
 # Copyright (c) ZeroC, Inc.
 
 
-from Util import Client, ClientServerTestCase, Server, TestSuite
+from Util import (
+    Client,
+    ClientServerTestCase,
+    CppMapping,
+    Linux,
+    Server,
+    TestSuite,
+    platform,
+)
 
 
 class UdpTestCase(ClientServerTestCase):
+    def __init__(self, name="client/server", props=None):
+        ClientServerTestCase.__init__(self, name)
+        self.props = props or {}
+
     def setupServerSide(self, current):
         if current.config.android:
-            self.servers = [Server(ready="McastTestAdapter")]
+            self.servers = [Server(ready="McastTestAdapter", props=self.props)]
         else:
             self.servers = [
-                Server(args=[i], ready="McastTestAdapter") for i in range(0, 5)
+                Server(args=[i], ready="McastTestAdapter", props=self.props)
+                for i in range(0, 5)
             ]
 
     def setupClientSide(self, current):
         if current.config.android:
-            self.clients = [Client()]
+            self.clients = [Client(props=self.props)]
         else:
-            self.clients = [Client(args=[5])]
+            self.clients = [Client(args=[5], props=self.props)]
+
+
+class BatchUdpTestCase(UdpTestCase):
+    def __init__(self):
+        UdpTestCase.__init__(
+            self,
+            "client/server with batched datagrams",
+            props={"Ice.UDP.BatchSize": 32},
+        )
+
+    def canRun(self, current):
+        # recvmmsg and sendmmsg are only used by the C++ mapping on Linux.
+        return isinstance(self.getMapping(), CppMapping) and isinstance(platform, Linux)
 
 
-TestSuite(__name__, [UdpTestCase()], multihost=False)
+TestSuite(__name__, [UdpTestCase(), BatchUdpTestCase()], multihost=False)